@@ -153,32 +153,7 @@ namespace json {
 
     auto const string_def = bp::lexeme['"' >> *(string_char - '"') > '"'];
 
-    auto parse_double = [](auto & ctx) {
-        auto const cp_range = _attr(ctx);
-        auto cp_first = cp_range.begin();
-        auto const cp_last = cp_range.end();
-
-        auto const result = bp::prefix_parse(cp_first, cp_last, bp::double_);
-        if (result) {
-            _val(ctx) = *result;
-        } else {
-            // This would be more efficient if we used
-            // boost::container::small_vector, or std::inplace_vector from
-            // C++26.
-            std::vector<char> chars(cp_first, cp_last);
-            auto const chars_first = &*chars.begin();
-            auto chars_last = chars_first + chars.size();
-            _val(ctx) = std::strtod(chars_first, &chars_last);
-        }
-    };
-
-    auto const number_def =
-        bp::raw[bp::lexeme
-                    [-bp::char_('-') >>
-                     (bp::char_('1', '9') >> *bp::digit | bp::char_('0')) >>
-                     -(bp::char_('.') >> +bp::digit) >>
-                     -(bp::char_("eE") >> -bp::char_("+-") >> +bp::digit)]]
-               [parse_double];
+    auto const number_def = bp::json_number;
 
     // The object_element_key parser is exactly the same as the string parser.
     // Note that we did *not* use string here, though; we used string_def.  If
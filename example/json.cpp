@@ -199,41 +199,14 @@ namespace json {
 
     auto const string_def = bp::lexeme['"' >> *(string_char - '"') > '"'];
 
-    // Since the JSON format for numbers is not exactly what
-    // boost::parser::double_ accepts (double_ accepts too much), we need to
-    // parse a JSON number as a sequence of characters, and then pass the
-    // result to double_ to actually get the numeric value.  This action does
-    // that.  The parser uses boost::parser::raw to produce the subrange of
-    // the input that covers the number as an attribute, which is used here.
-    auto parse_double = [](auto & ctx) {
-        auto const cp_range = _attr(ctx);
-        auto cp_first = cp_range.begin();
-        auto const cp_last = cp_range.end();
-
-        auto const result = bp::prefix_parse(cp_first, cp_last, bp::double_);
-        if (result) {
-            _val(ctx) = *result;
-        } else {
-            // This would be more efficient if we used
-            // boost::container::small_vector, or std::inplace_vector from
-            // C++26.
-            std::vector<char> chars(cp_first, cp_last);
-            auto const chars_first = &*chars.begin();
-            auto chars_last = chars_first + chars.size();
-            _val(ctx) = std::strtod(chars_first, &chars_last);
-        }
-    };
-
-    // As indicated above, we want to match the specific formats JSON allows,
-    // and then re-parse the resulting matched range within the semantic
-    // action.
-    auto const number_def =
-        bp::raw[bp::lexeme
-                    [-bp::char_('-') >>
-                     (bp::char_('1', '9') >> *bp::digit | bp::char_('0')) >>
-                     -(bp::char_('.') >> +bp::digit) >>
-                     -(bp::char_("eE") >> -bp::char_("+-") >> +bp::digit)]]
-               [parse_double];
+    // JSON's number format is stricter than the one boost::parser::double_
+    // accepts: no leading '+', no leading zeros, no "inf" or "nan", and at
+    // least one digit on each side of the decimal point.
+    // boost::parser::json_number is a double_ that accepts exactly that
+    // format.  Unlike double_, it also accepts numbers that are out of range
+    // for double, like 1e400 or 1e-400; as with strtod(), those produce
+    // infinity or zero.
+    auto const number_def = bp::json_number;
 
     // Note how, in the next three parsers, we turn off backtracking by using
     // > instead of >>, once we know that there is no backtracking alternative
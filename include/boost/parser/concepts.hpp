@@ -61,7 +61,8 @@ namespace boost { namespace parser {
         std::declval<ErrorHandler const &>(),
         std::declval<detail::nope &>(),
         std::declval<detail::symbol_table_tries_t &>(),
-        std::declval<detail::pending_symbol_table_operations_t &>()));
+        std::declval<detail::pending_symbol_table_operations_t &>(),
+        std::declval<detail::memo_tables_t &>()));
 
     template<typename T, typename I, typename S, typename GlobalState>
     concept error_handler =
@@ -59,6 +59,12 @@
     also defined. */
 #    define BOOST_PARSER_TRACE_TO_VS_OUTPUT
 
+/** Boost.Parser uses SSE2 or AVX2 instructions in a few places (such as
+    searching the nodes of its symbol table tries), when the compiler is
+    targeting a CPU that has them.  Define this macro to use only portable
+    code instead. */
+#    define BOOST_PARSER_DISABLE_SIMD
+
 #else
 
 #    ifdef BOOST_PARSER_NO_RUNTIME_ASSERTIONS
@@ -110,6 +116,20 @@
 #    define BOOST_PARSER_CONSTEXPR
 #endif
 
+#if !defined(BOOST_PARSER_DISABLE_SIMD) && defined(__AVX2__)
+#    define BOOST_PARSER_USE_AVX2 1
+#else
+#    define BOOST_PARSER_USE_AVX2 0
+#endif
+
+#if !defined(BOOST_PARSER_DISABLE_SIMD) &&                                     \
+    (defined(__SSE2__) || defined(_M_X64) ||                                   \
+     (defined(_M_IX86_FP) && 2 <= _M_IX86_FP))
+#    define BOOST_PARSER_USE_SSE2 1
+#else
+#    define BOOST_PARSER_USE_SSE2 0
+#endif
+
 #if defined(_MSC_VER) && defined(BOOST_PARSER_TRACE_TO_VS_OUTPUT)
 #    define BOOST_PARSER_TRACE_OSTREAM boost::parser::detail::vs_cout
 #else
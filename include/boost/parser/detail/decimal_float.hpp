@@ -0,0 +1,744 @@
+// Copyright (C) 2024 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_PARSER_DETAIL_DECIMAL_FLOAT_HPP
+#define BOOST_PARSER_DETAIL_DECIMAL_FLOAT_HPP
+
+#include <boost/parser/config.hpp>
+#include <boost/parser/detail/debug_assert.hpp>
+#include <boost/parser/detail/simd.hpp>
+
+#include <cfloat>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include <boost/parser/detail/power_of_five_generated.hpp>
+
+
+// Converting decimal numbers to binary floating-point, correctly rounded
+// (round to nearest, ties to even), for any iterator type.  The number is
+// scanned once, accumulating its first 19 significant digits.  Then:
+//
+// - If the digits and the power of ten are both exactly representable, one
+//   floating-point multiplication or division gives the correctly rounded
+//   result (Clinger's fast path).
+//
+// - Otherwise, the 19 digits are multiplied by a 128-bit approximation of the
+//   power of ten, which always determines the correctly rounded result
+//   (Eisel-Lemire; see Lemire, "Number Parsing at a Gigabyte per Second",
+//   and Mushtak and Lemire, "Fast Number Parsing Without Fallback").
+//
+// - If there were more than 19 digits, the result for the truncated digits
+//   and for the truncated digits plus one are compared.  In the rare case
+//   that they differ, all the digits are compared exactly, as a big integer,
+//   to the point halfway between the two candidates.
+
+namespace boost::parser::detail::numeric {
+
+    template<typename T>
+    struct binary_format;
+
+    template<>
+    struct binary_format<double>
+    {
+        using bits_type = std::uint64_t;
+        static constexpr int mantissa_bits = 52;
+        static constexpr int minimum_exponent = -1023;
+        static constexpr int infinite_power = 0x7ff;
+        static constexpr int min_exponent_round_to_even = -4;
+        static constexpr int max_exponent_round_to_even = 23;
+        static constexpr int max_exponent_fast_path = 22;
+        static constexpr std::uint64_t max_mantissa_fast_path = 2ull << 52;
+        static constexpr int smallest_power_of_ten = -342;
+        static constexpr int largest_power_of_ten = 308;
+        static constexpr double exact_powers_of_ten[] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+            1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+            1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    };
+
+    template<>
+    struct binary_format<float>
+    {
+        using bits_type = std::uint32_t;
+        static constexpr int mantissa_bits = 23;
+        static constexpr int minimum_exponent = -127;
+        static constexpr int infinite_power = 0xff;
+        static constexpr int min_exponent_round_to_even = -17;
+        static constexpr int max_exponent_round_to_even = 10;
+        static constexpr int max_exponent_fast_path = 10;
+        static constexpr std::uint64_t max_mantissa_fast_path = 2ull << 23;
+        static constexpr int smallest_power_of_ten = -64;
+        static constexpr int largest_power_of_ten = 38;
+        static constexpr float exact_powers_of_ten[] = {
+            1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+    };
+
+    /** True iff `T` can be parsed by parse_decimal_float(). */
+    template<typename T>
+    constexpr bool is_decimal_float =
+        (std::is_same_v<T, double> || std::is_same_v<T, float>) &&
+        std::numeric_limits<T>::is_iec559;
+
+    /** Clinger's fast path relies on each floating-point operation being
+        rounded to the precision of its type. */
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    inline constexpr bool use_clinger_fast_path = true;
+#else
+    inline constexpr bool use_clinger_fast_path = false;
+#endif
+
+    struct uint128
+    {
+        std::uint64_t high;
+        std::uint64_t low;
+    };
+
+    inline uint128 full_multiplication(std::uint64_t a, std::uint64_t b) noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+        unsigned __int128 const product = (unsigned __int128)a * b;
+        return {std::uint64_t(product >> 64), std::uint64_t(product)};
+#elif defined(_MSC_VER) && defined(_M_X64)
+        uint128 retval;
+        retval.low = _umul128(a, b, &retval.high);
+        return retval;
+#else
+        std::uint64_t const a_lo = std::uint32_t(a), a_hi = a >> 32;
+        std::uint64_t const b_lo = std::uint32_t(b), b_hi = b >> 32;
+        std::uint64_t const lo_lo = a_lo * b_lo;
+        std::uint64_t const hi_lo = a_hi * b_lo;
+        std::uint64_t const lo_hi = a_lo * b_hi;
+        std::uint64_t const hi_hi = a_hi * b_hi;
+        std::uint64_t const cross =
+            (lo_lo >> 32) + std::uint32_t(hi_lo) + lo_hi;
+        return {
+            hi_hi + (hi_lo >> 32) + (cross >> 32),
+            (cross << 32) | std::uint32_t(lo_lo)};
+#endif
+    }
+
+    /** A binary floating-point value, as the biased exponent and explicit
+        mantissa bits of its representation. */
+    struct adjusted_mantissa
+    {
+        std::uint64_t mantissa;
+        int power2;
+
+        friend bool
+        operator==(adjusted_mantissa lhs, adjusted_mantissa rhs) noexcept
+        {
+            return lhs.mantissa == rhs.mantissa && lhs.power2 == rhs.power2;
+        }
+        friend bool
+        operator!=(adjusted_mantissa lhs, adjusted_mantissa rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
+
+    /** Returns the correctly rounded `T` nearest `w * 10^q` (Eisel-Lemire).
+        The result is always correct, for any `w`; see the proof in Mushtak
+        and Lemire. */
+    template<typename T>
+    adjusted_mantissa compute_float(std::int64_t q, std::uint64_t w) noexcept
+    {
+        using format = binary_format<T>;
+        if (!w || q < format::smallest_power_of_ten)
+            return {0, 0};
+        if (format::largest_power_of_ten < q)
+            return {0, format::infinite_power};
+
+        int const lz = simd::countl_zero(w);
+        w <<= lz;
+
+        // Only the high 64 + mantissa_bits + 3 bits of the product are
+        // needed; the second half of the power of five is only used when
+        // they might be affected by carries from the bits below.
+        int const index = 2 * int(q - smallest_power_of_five);
+        uint128 product = full_multiplication(w, power_of_five_128[index]);
+        constexpr std::uint64_t precision_mask =
+            0xffffffffffffffffull >> (format::mantissa_bits + 3);
+        if ((product.high & precision_mask) == precision_mask) {
+            uint128 const second =
+                full_multiplication(w, power_of_five_128[index + 1]);
+            product.low += second.high;
+            if (second.high > product.low)
+                ++product.high;
+        }
+
+        int const upper_bit = int(product.high >> 63);
+        int const shift = upper_bit + 64 - format::mantissa_bits - 3;
+        adjusted_mantissa retval;
+        retval.mantissa = product.high >> shift;
+        // ((152170 + 65536) * q) >> 16 is floor(q * log2(10)).
+        retval.power2 = int(
+            (((152170 + 65536) * q) >> 16) + 63 + upper_bit - lz -
+            format::minimum_exponent);
+
+        if (retval.power2 <= 0) {
+            // Subnormal, or zero.
+            if (64 <= -retval.power2 + 1)
+                return {0, 0};
+            retval.mantissa >>= -retval.power2 + 1;
+            retval.mantissa += retval.mantissa & 1;
+            retval.mantissa >>= 1;
+            // Rounding up may have made the value normal.
+            retval.power2 =
+                retval.mantissa < (1ull << format::mantissa_bits) ? 0 : 1;
+            return retval;
+        }
+
+        // Exactly halfway between two values can only happen when 5^q fits
+        // in 64 bits; in that case, round to even rather than up.
+        if (product.low <= 1 && format::min_exponent_round_to_even <= q &&
+            q <= format::max_exponent_round_to_even &&
+            (retval.mantissa & 3) == 1 &&
+            (retval.mantissa << shift) == product.high) {
+            retval.mantissa &= ~1ull;
+        }
+
+        retval.mantissa += retval.mantissa & 1;
+        retval.mantissa >>= 1;
+        if ((2ull << format::mantissa_bits) <= retval.mantissa) {
+            retval.mantissa = 1ull << format::mantissa_bits;
+            ++retval.power2;
+        }
+        retval.mantissa &= ~(1ull << format::mantissa_bits);
+        if (format::infinite_power <= retval.power2)
+            return {0, format::infinite_power};
+        return retval;
+    }
+
+    template<typename T>
+    T to_float(bool negative, adjusted_mantissa am) noexcept
+    {
+        using format = binary_format<T>;
+        using bits_type = typename format::bits_type;
+        bits_type bits = bits_type(am.mantissa) |
+                         (bits_type(am.power2) << format::mantissa_bits);
+        if (negative)
+            bits |= bits_type(1) << (sizeof(T) * 8 - 1);
+        T retval;
+        std::memcpy(&retval, &bits, sizeof(T));
+        return retval;
+    }
+
+    /** A fixed-capacity unsigned big integer, just large enough to compare
+        any decimal number of up to max_big_digits digits to a point halfway
+        between two doubles. */
+    struct big_uint
+    {
+        static constexpr int capacity = 128;
+
+        std::uint32_t limbs_[capacity];
+        int size_ = 0;
+
+        explicit big_uint(std::uint64_t x = 0) noexcept
+        {
+            for (; x; x >>= 32) {
+                limbs_[size_++] = std::uint32_t(x);
+            }
+        }
+
+        void mul_add(std::uint32_t m, std::uint32_t a = 0) noexcept
+        {
+            std::uint64_t carry = a;
+            for (int i = 0; i < size_; ++i) {
+                std::uint64_t const x = std::uint64_t(limbs_[i]) * m + carry;
+                limbs_[i] = std::uint32_t(x);
+                carry = x >> 32;
+            }
+            if (carry) {
+                BOOST_PARSER_DEBUG_ASSERT(size_ < capacity);
+                limbs_[size_++] = std::uint32_t(carry);
+            }
+        }
+
+        void mul_pow5(int n) noexcept
+        {
+            constexpr std::uint32_t pow5_13 = 1220703125;
+            for (; 13 <= n; n -= 13) {
+                mul_add(pow5_13);
+            }
+            std::uint32_t m = 1;
+            for (; n; --n) {
+                m *= 5;
+            }
+            if (m != 1)
+                mul_add(m);
+        }
+
+        void shift_left(int n) noexcept
+        {
+            if (!size_ || !n)
+                return;
+            int const limbs = n / 32;
+            int const bits = n % 32;
+            BOOST_PARSER_DEBUG_ASSERT(size_ + limbs + 1 <= capacity);
+            if (bits) {
+                limbs_[size_] = 0;
+                for (int i = size_; 0 < i; --i) {
+                    limbs_[i] = (limbs_[i] << bits) |
+                                (limbs_[i - 1] >> (32 - bits));
+                }
+                limbs_[0] <<= bits;
+                if (limbs_[size_])
+                    ++size_;
+            }
+            if (limbs) {
+                for (int i = size_ - 1; 0 <= i; --i) {
+                    limbs_[i + limbs] = limbs_[i];
+                }
+                for (int i = 0; i < limbs; ++i) {
+                    limbs_[i] = 0;
+                }
+                size_ += limbs;
+            }
+        }
+
+        friend int compare(big_uint const & lhs, big_uint const & rhs) noexcept
+        {
+            if (lhs.size_ != rhs.size_)
+                return lhs.size_ < rhs.size_ ? -1 : 1;
+            for (int i = lhs.size_ - 1; 0 <= i; --i) {
+                if (lhs.limbs_[i] != rhs.limbs_[i])
+                    return lhs.limbs_[i] < rhs.limbs_[i] ? -1 : 1;
+            }
+            return 0;
+        }
+    };
+
+    /** Digits past this many cannot affect the rounding of a double, except
+        by being nonzero. */
+    inline constexpr int max_big_digits = 768;
+
+    template<typename Char>
+    constexpr bool is_decimal_digit(Char c) noexcept
+    {
+        return '0' <= c && c <= '9';
+    }
+
+    /** True iff the eight chars in `word` (the first in its lowest byte)
+        are all decimal digits. */
+    constexpr bool eight_digits(std::uint64_t word) noexcept
+    {
+        return ((word & 0xf0f0f0f0f0f0f0f0) |
+                (((word + 0x0606060606060606) & 0xf0f0f0f0f0f0f0f0) >> 4)) ==
+               0x3333333333333333;
+    }
+
+    /** Returns the value of the eight decimal digits in `word` (the first
+        in its lowest byte). */
+    constexpr std::uint32_t eight_digits_value(std::uint64_t word) noexcept
+    {
+        constexpr std::uint64_t mask = 0x000000ff000000ff;
+        word -= 0x3030303030303030;
+        word = word * 10 + (word >> 8);
+        return std::uint32_t(
+            ((word & mask) * (100 + (1000000ull << 32)) +
+             ((word >> 16) & mask) * (1 + (10000ull << 32))) >>
+            32);
+    }
+
+    /** True iff `it` refers to a `Separator` followed by a digit.  A digit
+        separator is only part of a number between two digits. */
+    template<char Separator, typename I, typename S>
+    bool at_digit_separator(I it, S last)
+    {
+        if constexpr (Separator == '\0') {
+            return false;
+        } else {
+            if (*it != Separator)
+                return false;
+            ++it;
+            return it != last && is_decimal_digit(*it);
+        }
+    }
+
+    /** Appends the decimal digits at `it`, which may be separated by
+        `Separator`s, to `w`, advancing `it` past them and adding their
+        number to `digit_count`.  If `EightAtATime`, contiguous chars are
+        examined eight at a time where possible; that only pays for long
+        runs of digits, which are typical of fractions but not of integer
+        parts. */
+    template<bool EightAtATime, char Separator, typename I, typename S>
+    void scan_digits(
+        I & it, S last, std::uint64_t & w, std::int64_t & digit_count)
+    {
+        bool any_digits = false;
+#if BOOST_PARSER_USE_SWAR_DIGITS
+        if constexpr (
+            EightAtATime && std::is_same_v<I, char const *> &&
+            std::is_same_v<S, char const *>) {
+            while (8 <= last - it) {
+                std::uint64_t word;
+                std::memcpy(&word, it, 8);
+                if (!numeric::eight_digits(word))
+                    break;
+                w = w * 100000000 + numeric::eight_digits_value(word);
+                it += 8;
+                digit_count += 8;
+                any_digits = true;
+            }
+        }
+#endif
+        for (; it != last; ++it) {
+            std::uint32_t const digit = std::uint32_t(*it) - '0';
+            if (9 < digit) {
+                if (any_digits && at_digit_separator<Separator>(it, last))
+                    continue;
+                break;
+            }
+            w = 10 * w + digit;
+            ++digit_count;
+            any_digits = true;
+        }
+    }
+
+    /** The parts of a scanned decimal number: `[int_first, int_last)` and
+        `[frac_first, frac_last)` are the digits (and any digit separators)
+        before and after the decimal point, and `exponent` the explicit
+        exponent.  `mantissa *
+        10^mantissa_exponent` is the number's first 19 significant digits
+        (all of them, if `!truncated`). */
+    template<typename I>
+    struct decimal_number
+    {
+        std::uint64_t mantissa = 0;
+        std::int64_t mantissa_exponent = 0;
+        std::int64_t exponent = 0;
+        bool negative = false;
+        bool truncated = false;
+        I int_first;
+        I int_last;
+        I frac_first;
+        I frac_last;
+    };
+
+    /** Compares all the digits of `d` exactly to the point halfway between
+        `am` and the next larger value, and returns whichever of the two is
+        nearer to `d`. */
+    template<typename T, typename I>
+    adjusted_mantissa
+    round_by_digits(decimal_number<I> const & d, adjusted_mantissa am) noexcept
+    {
+        using format = binary_format<T>;
+
+        // All the digits, as an integer, times 10^exponent.
+        big_uint digits;
+        std::int64_t exponent = d.exponent;
+        int significant_digits = 0;
+        bool nonzero_dropped = false;
+        std::uint32_t chunk = 0;
+        int chunk_digits = 0;
+        auto const add_digits = [&](I first, I last, bool fraction) {
+            for (; first != last; ++first) {
+                if (!is_decimal_digit(*first))
+                    continue;
+                int const digit = *first - '0';
+                if (significant_digits == max_big_digits) {
+                    if (!fraction)
+                        ++exponent;
+                    nonzero_dropped |= digit != 0;
+                    continue;
+                }
+                if (fraction)
+                    --exponent;
+                if (significant_digits || digit)
+                    ++significant_digits;
+                chunk = chunk * 10 + digit;
+                if (++chunk_digits == 9) {
+                    digits.mul_add(1000000000, chunk);
+                    chunk = 0;
+                    chunk_digits = 0;
+                }
+            }
+        };
+        add_digits(d.int_first, d.int_last, false);
+        add_digits(d.frac_first, d.frac_last, true);
+        if (chunk_digits) {
+            std::uint32_t scale = 1;
+            for (int i = 0; i < chunk_digits; ++i) {
+                scale *= 10;
+            }
+            digits.mul_add(scale, chunk);
+        }
+
+        // The halfway point, (2 * m + 1) * 2^(e - 1).
+        std::uint64_t m = am.mantissa;
+        int e = 1 + format::minimum_exponent - format::mantissa_bits;
+        if (am.power2) {
+            m |= 1ull << format::mantissa_bits;
+            e = am.power2 + format::minimum_exponent - format::mantissa_bits;
+        }
+        big_uint halfway(2 * m + 1);
+
+        // Compare digits * 5^exponent * 2^exponent to halfway * 2^(e - 1).
+        std::int64_t shift = exponent - (e - 1);
+        if (0 <= exponent)
+            digits.mul_pow5(int(exponent));
+        else
+            halfway.mul_pow5(int(-exponent));
+        if (0 <= shift)
+            digits.shift_left(int(shift));
+        else
+            halfway.shift_left(int(-shift));
+
+        int cmp = compare(digits, halfway);
+        if (!cmp && nonzero_dropped)
+            cmp = 1;
+        if (0 < cmp || (!cmp && (m & 1))) {
+            ++am.mantissa;
+            if (am.mantissa == (1ull << format::mantissa_bits)) {
+                // Carry into the exponent; this also takes the largest
+                // subnormal to the smallest normal value.
+                am.mantissa = 0;
+                ++am.power2;
+            }
+        }
+        return am;
+    }
+
+    /** Case-insensitively matches the lowercase ASCII `str` at `first`.
+        On success, `first` is advanced past the match. */
+    template<typename I, typename S>
+    bool match_lowercase(I & first, S last, char const * str)
+    {
+        I it = first;
+        for (; *str; ++str, ++it) {
+            if (it == last ||
+                std::uint32_t(*it | 0x20) != std::uint32_t(*str)) {
+                return false;
+            }
+        }
+        first = it;
+        return true;
+    }
+
+    /** Matches an optional sign, as allowed by `Policies`, and returns
+        true iff it is '-'. */
+    template<typename Policies, typename I, typename S>
+    bool scan_sign(I & it, S last)
+    {
+        if (it == last)
+            return false;
+        if (Policies::allow_minus && *it == '-') {
+            ++it;
+            return true;
+        }
+        if (Policies::allow_plus && *it == '+')
+            ++it;
+        return false;
+    }
+
+    /** Scans the number at `first`, in the syntax described by `Policies`
+        (see float_policies): an optional sign, then digits with an
+        optional decimal point (at least one digit in all), then an
+        optional exponent.  If `Policies::require_fraction_or_exponent`,
+        the decimal point and the exponent may not both be missing.  On
+        success, `first` is advanced past the number. */
+    template<typename Policies, typename I, typename S>
+    bool scan_decimal(I & first, S last, decimal_number<I> & d)
+    {
+        constexpr char separator = Policies::digit_separator;
+
+        I it = first;
+        d.negative = numeric::scan_sign<Policies>(it, last);
+
+        std::uint64_t w = 0;
+        std::int64_t digit_count = 0;
+        d.int_first = it;
+        if (!Policies::allow_leading_zeros && it != last && *it == '0') {
+            ++it;
+            digit_count = 1;
+        } else {
+            numeric::scan_digits<false, separator>(it, last, w, digit_count);
+        }
+        d.int_last = it;
+        std::int64_t const int_digits = digit_count;
+        if (!Policies::allow_leading_dot && !int_digits)
+            return false;
+        d.frac_first = d.frac_last = it;
+        bool point_or_exponent = false;
+        if (it != last && *it == '.') {
+            I const frac = std::next(it);
+            if (Policies::allow_trailing_dot ||
+                (frac != last && is_decimal_digit(*frac))) {
+                point_or_exponent = true;
+                it = frac;
+                d.frac_first = it;
+                numeric::scan_digits<true, separator>(
+                    it, last, w, digit_count);
+                d.frac_last = it;
+            }
+        }
+        if (!digit_count)
+            return false;
+        std::int64_t const frac_digits = digit_count - int_digits;
+
+        if (Policies::allow_exponent && it != last &&
+            (*it == 'e' || *it == 'E')) {
+            I const e_position = it;
+            ++it;
+            bool negative_exponent = false;
+            if (it != last && (*it == '-' || *it == '+')) {
+                negative_exponent = *it == '-';
+                ++it;
+            }
+            if (it == last || !is_decimal_digit(*it)) {
+                // Not an exponent after all.
+                it = e_position;
+            } else {
+                std::int64_t exponent = 0;
+                for (; it != last; ++it) {
+                    if (!is_decimal_digit(*it)) {
+                        if (at_digit_separator<separator>(it, last))
+                            continue;
+                        break;
+                    }
+                    if (exponent < 0x10000)
+                        exponent = 10 * exponent + (*it - '0');
+                }
+                d.exponent = negative_exponent ? -exponent : exponent;
+                point_or_exponent = true;
+            }
+        }
+        if (Policies::require_fraction_or_exponent && !point_or_exponent)
+            return false;
+        first = it;
+
+        d.mantissa = w;
+        d.mantissa_exponent = d.exponent - frac_digits;
+        if (19 < digit_count) {
+            // Leading zeros are not significant.  Any non-digits here are
+            // digit separators.
+            auto const count_zeros = [&](I zeros, I last) {
+                for (; zeros != last; ++zeros) {
+                    if (*zeros == '0')
+                        --digit_count;
+                    else if (is_decimal_digit(*zeros))
+                        break;
+                }
+                return zeros == last;
+            };
+            if (count_zeros(d.int_first, d.int_last))
+                count_zeros(d.frac_first, d.frac_last);
+            if (19 < digit_count) {
+                // Keep only the first 19 significant digits.
+                constexpr std::uint64_t min_19_digits = 1000000000000000000;
+                d.truncated = true;
+                w = 0;
+                std::int64_t int_digits_left = int_digits;
+                I digit = d.int_first;
+                for (; w < min_19_digits && digit != d.int_last; ++digit) {
+                    if (is_decimal_digit(*digit)) {
+                        w = 10 * w + std::uint64_t(*digit - '0');
+                        --int_digits_left;
+                    }
+                }
+                if (min_19_digits <= w) {
+                    d.mantissa_exponent = d.exponent + int_digits_left;
+                } else {
+                    std::int64_t frac_digits_used = 0;
+                    digit = d.frac_first;
+                    for (; w < min_19_digits && digit != d.frac_last;
+                         ++digit) {
+                        if (is_decimal_digit(*digit)) {
+                            w = 10 * w + std::uint64_t(*digit - '0');
+                            ++frac_digits_used;
+                        }
+                    }
+                    d.mantissa_exponent = d.exponent - frac_digits_used;
+                }
+                d.mantissa = w;
+            }
+        }
+        return true;
+    }
+
+    /** Parses a decimal floating-point number, "inf", "infinity", "nan", or
+        "nan(...)", with an optional sign, into `attr`, correctly rounded;
+        `Policies` (see float_policies) may restrict or extend that syntax.
+        The number is validated and converted in the same pass over the
+        input.  As with std::from_chars(), the parse fails if the value is
+        too large for `T`, or rounds to zero from a nonzero number, unless
+        `Policies::allow_out_of_range`.  On success, `first` is advanced past
+        the number; otherwise, it is unchanged. */
+    template<typename Policies, typename I, typename S, typename T>
+    bool parse_decimal_float(I & first, S last, T & attr)
+    {
+        using format = binary_format<T>;
+
+        decimal_number<I> d;
+        I it = first;
+        if (!numeric::scan_decimal<Policies>(it, last, d)) {
+            if constexpr (!Policies::allow_inf_nan)
+                return false;
+            it = first;
+            bool const negative = numeric::scan_sign<Policies>(it, last);
+            if (match_lowercase(it, last, "inf")) {
+                match_lowercase(it, last, "inity");
+                attr = negative ? -std::numeric_limits<T>::infinity()
+                                : std::numeric_limits<T>::infinity();
+                first = it;
+                return true;
+            }
+            if (match_lowercase(it, last, "nan")) {
+                if (it != last && *it == '(') {
+                    I paren = it;
+                    for (++paren;
+                         paren != last && *paren != ')' &&
+                         (std::uint32_t((*paren | 0x20) - 'a') < 26u ||
+                          is_decimal_digit(*paren) || *paren == '_');
+                         ++paren) {
+                    }
+                    if (paren != last && *paren == ')')
+                        it = ++paren;
+                }
+                attr = negative ? -std::numeric_limits<T>::quiet_NaN()
+                                : std::numeric_limits<T>::quiet_NaN();
+                first = it;
+                return true;
+            }
+            return false;
+        }
+
+        if (use_clinger_fast_path && !d.truncated &&
+            -format::max_exponent_fast_path <= d.mantissa_exponent &&
+            d.mantissa_exponent <= format::max_exponent_fast_path &&
+            d.mantissa <= format::max_mantissa_fast_path) {
+            T value = T(d.mantissa);
+            if (d.mantissa_exponent < 0)
+                value /= format::exact_powers_of_ten[-d.mantissa_exponent];
+            else
+                value *= format::exact_powers_of_ten[d.mantissa_exponent];
+            attr = d.negative ? -value : value;
+            first = it;
+            return true;
+        }
+
+        adjusted_mantissa am =
+            numeric::compute_float<T>(d.mantissa_exponent, d.mantissa);
+        if (d.truncated &&
+            am != numeric::compute_float<T>(
+                      d.mantissa_exponent, d.mantissa + 1)) {
+            am = numeric::round_by_digits<T>(d, am);
+        }
+        if constexpr (!Policies::allow_out_of_range) {
+            if (am.power2 == format::infinite_power ||
+                (!am.power2 && !am.mantissa && d.mantissa)) {
+                return false;
+            }
+        }
+        attr = numeric::to_float<T>(d.negative, am);
+        first = it;
+        return true;
+    }
+}
+
+#endif
@@ -12,6 +12,8 @@
 #ifndef BOOST_PARSER_DETAIL_NUMERIC_HPP
 #define BOOST_PARSER_DETAIL_NUMERIC_HPP
 
+#include <boost/parser/detail/decimal_float.hpp>
+#include <boost/parser/detail/simd.hpp>
 #include <boost/parser/detail/text/unpack.hpp>
 
 #if __has_include(<charconv>)
@@ -29,7 +31,15 @@
 #define BOOST_PARSER_NUMERIC_NS spirit_parsers
 #endif
 
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
 #include <type_traits>
+#include <vector>
 #include <cmath>
 
 #if defined(BOOST_PARSER_HAVE_STD_CHARCONV) ||                                 \
@@ -999,24 +1009,237 @@ namespace boost::parser::detail::numeric {
                                        std::declval<I>(), std::declval<S>())
                                        .first);
 
+    template<typename T>
+    constexpr bool is_code_unit =
+        std::is_same_v<T, char> || std::is_same_v<T, char16_t> ||
+        std::is_same_v<T, char32_t> || std::is_same_v<T, wchar_t>
+#if defined(__cpp_char8_t)
+        || std::is_same_v<T, char8_t>
+#endif
+        ;
+
+    template<typename I, typename T>
+    constexpr bool is_std_contiguous_iter =
+        std::is_same_v<I, typename std::basic_string<T>::iterator> ||
+        std::is_same_v<I, typename std::basic_string<T>::const_iterator> ||
+        std::is_same_v<I, typename std::basic_string_view<T>::const_iterator> ||
+        std::is_same_v<I, typename std::vector<T>::iterator> ||
+        std::is_same_v<I, typename std::vector<T>::const_iterator>;
+
+    template<typename I>
+    constexpr bool is_contiguous_char_iter()
+    {
+        using value_type = text::detail::iter_value_t<I>;
+        if constexpr (!is_code_unit<value_type> || sizeof(value_type) != 1) {
+            return false;
+        } else {
+#if BOOST_PARSER_USE_CONCEPTS
+            return std::contiguous_iterator<I>;
+#else
+            return std::is_pointer_v<I> ||
+                   is_std_contiguous_iter<I, value_type>;
+#endif
+        }
+    }
+
+    /** True iff `I` is an iterator to contiguous one-byte code units
+        (`char`s or `char8_t`s).  Without concepts, only pointers and the
+        iterators of `std::basic_string`, `std::basic_string_view` and
+        `std::vector` are recognized. */
+    template<typename I>
+    constexpr bool contiguous_char_iter = is_contiguous_char_iter<I>();
+
+    /** True iff `[first, last)` is, or is a transcoding view of, a common
+        range of contiguous UTF-8 code units, so that numbers can be parsed
+        directly from the underlying `char`s. */
     template<typename I, typename S>
     constexpr bool unpacks_to_chars =
-        std::is_pointer_v<unpacked_iter<I, S>> && std::is_same_v<
-            std::remove_cv_t<std::remove_reference_t<
-                std::remove_pointer_t<unpacked_iter<I, S>>>>,
-            char>;
+        common_range<I, S> && contiguous_char_iter<unpacked_iter<I, S>>;
+
+    /** True iff `[first, last)` is, or is a transcoding view of, a common
+        range of code units of any UTF; numbers in it can be parsed from
+        the underlying code units, one-byte ones directly when
+        `unpacks_to_chars<I, S>`, and others after copying them to a
+        buffer.  Copying reads ahead of the number, so it is not done for
+        sentinels, which may observe how far the parse looked (as
+        incremental_parse's does). */
+    template<typename I, typename S>
+    constexpr bool unpacks_to_code_units =
+        common_range<I, S> &&
+        is_code_unit<text::detail::iter_value_t<unpacked_iter<I, S>>>;
+
+    /** The size of the buffer that non-contiguous or wider-than-one-byte
+        code units are copied into.  Longer numbers are left to the
+        char-at-a-time parsers. */
+    inline constexpr int number_buffer_size = 64;
+
+    /** True iff `c` may be part of a number std::from_chars() can parse:
+        a digit, letter (as in hex digits, exponents, "inf" and "nan"),
+        sign, or '.'; or one of the '(', ')' and '_' that can appear in
+        "nan(...)". */
+    constexpr bool is_number_char(std::uint32_t c) noexcept
+    {
+        std::uint32_t const lower = c | 0x20;
+        return ('0' <= c && c <= '9') || ('a' <= lower && lower <= 'z') ||
+               c == '+' || c == '-' || c == '.' || c == '(' || c == ')' ||
+               c == '_';
+    }
+
+    /** The `char`s underlying `[first, last)`, where
+        `unpacks_to_code_units<I, S>`.  When `unpacks_to_chars<I, S>`,
+        these are the code units themselves; otherwise, the leading code
+        units that may be part of a number are copied to `buffer`.  If that
+        fills the buffer before the input ends, `complete` is false, and the
+        other members are unspecified.  `repack(p)` returns the `I` that
+        refers to the same position as `p`. */
+    template<typename I, typename S>
+    auto unpack_to_chars(I first, S last, char (&buffer)[number_buffer_size])
+    {
+        static_assert(unpacks_to_code_units<I, S>);
+        auto const unpacked = text::unpack_iterator_and_sentinel(first, last);
+        using unpacked_t = std::remove_const_t<decltype(unpacked)>;
+        struct chars
+        {
+            unpacked_t unpacked;
+            char const * first;
+            char const * last;
+            bool complete;
+
+            I repack(char const * p) const
+            {
+                return unpacked.repack(std::next(unpacked.first, p - first));
+            }
+        };
+        if constexpr (unpacks_to_chars<I, S>) {
+            if (unpacked.first == unpacked.last)
+                return chars{unpacked, nullptr, nullptr, true};
+            char const * const p = reinterpret_cast<char const *>(
+                std::addressof(*unpacked.first));
+            return chars{
+                unpacked, p, p + (unpacked.last - unpacked.first), true};
+        } else {
+            using unit_t =
+                text::detail::iter_value_t<unpacked_iter<I, S>>;
+            int n = 0;
+            auto it = unpacked.first;
+            for (; n < number_buffer_size && it != unpacked.last; ++it, ++n) {
+                std::uint32_t const c = std::make_unsigned_t<unit_t>(*it);
+                if (!is_number_char(c))
+                    break;
+                buffer[n] = (char)c;
+            }
+            bool const complete =
+                n < number_buffer_size || it == unpacked.last;
+            return chars{unpacked, buffer, buffer + n, complete};
+        }
+    }
+
+    /** std::from_chars() accepts a leading '-', but not a leading '+'; the
+        Spirit-derived parsers accept either one.  Returns the position
+        from_chars() should start at, or null if there is no number to
+        parse. */
+    template<bool Signed>
+    char const * skip_sign(char const * first, char const * last) noexcept
+    {
+        if (first == last)
+            return nullptr;
+        if (*first == '+') {
+            ++first;
+            if (!Signed || first == last || *first == '-')
+                return nullptr;
+        } else if (!Signed && *first == '-') {
+            return nullptr;
+        }
+        return first;
+    }
 
     inline namespace BOOST_PARSER_NUMERIC_NS {
 
         template<int MinDigits, int MaxDigits, typename I, typename S>
 #if defined(BOOST_PARSER_HAVE_CHARCONV)
         constexpr bool use_charconv_int =
-            MinDigits == 1 && MaxDigits == -1 &&
-            common_range<I, S> && unpacks_to_chars<I, S>;
+            MinDigits == 1 && MaxDigits == -1 && unpacks_to_code_units<I, S>;
 #else
         constexpr bool use_charconv_int = false;
 #endif
 
+        template<
+            bool Signed,
+            int Radix,
+            int MaxDigits,
+            typename I,
+            typename S,
+            typename T>
+        constexpr bool use_swar_uint =
+            BOOST_PARSER_USE_SWAR_DIGITS && !Signed &&
+            (Radix == 10 || Radix == 16) && 1 < MaxDigits && MaxDigits <= 8 &&
+            std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+            unpacks_to_chars<I, S>;
+
+        /** Returns a word with the high bit of each byte of `word` set iff
+            that byte is in `[lo, hi]`, where `hi < 0x80`.  No carry or
+            borrow crosses a byte boundary, so each byte's result depends on
+            that byte alone. */
+        constexpr std::uint64_t
+        bytes_in_range(std::uint64_t word, unsigned lo, unsigned hi) noexcept
+        {
+            constexpr std::uint64_t ones = 0x0101010101010101;
+            std::uint64_t const low7 = word & ones * 0x7f;
+            return (ones * (0x80 + hi) - low7) & ~word &
+                   (low7 + ones * (0x80 - lo)) & ones * 0x80;
+        }
+
+        /** Parses up to `MaxDigits` leading base-`Radix` digits of `[first,
+            last)`, all at once, and returns how many there were.  Their
+            value is written to `value`.  Radix must be 10 or 16, and
+            `MaxDigits` at most 8, so the value always fits in 32 bits. */
+        template<int Radix, int MaxDigits>
+        int parse_digits_swar(
+            char const * first,
+            char const * last,
+            std::uint32_t & value) noexcept
+        {
+            static_assert(Radix == 10 || Radix == 16);
+            static_assert(0 < MaxDigits && MaxDigits <= 8);
+            constexpr std::uint64_t ones = 0x0101010101010101;
+
+            // A zero byte is never a digit, so a short tail can be padded
+            // with zeros.
+            std::uint64_t word = 0;
+            std::memcpy(&word, first, 8 <= last - first ? 8 : last - first);
+
+            std::uint64_t digits = bytes_in_range(word, '0', '9');
+            if constexpr (Radix == 16) {
+                digits |= bytes_in_range(word, 'A', 'F') |
+                          bytes_in_range(word, 'a', 'f');
+            }
+            std::uint64_t const non_digits = ~digits & ones * 0x80;
+            int n = non_digits ? simd::countr_zero(non_digits) / 8 : 8;
+            if (MaxDigits < n)
+                n = MaxDigits;
+            if (!n) {
+                value = 0;
+                return 0;
+            }
+
+            // Shift the digits to the top of the word, so the vacated bytes
+            // act as leading zeros, then turn each char into its value.
+            word <<= 8 * (8 - n);
+            if constexpr (Radix == 10)
+                word &= ones * 0x0f;
+            else
+                word = (word & ones * 0x0f) + ((word >> 6) & ones) * 9;
+
+            // Combine adjacent bytes, then adjacent 16-bit lanes, then
+            // adjacent 32-bit lanes; the first char is the most significant.
+            constexpr std::uint64_t radix_2 = Radix * Radix;
+            word = (word * Radix + (word >> 8)) & 0x00ff00ff00ff00ff;
+            word = (word * radix_2 + (word >> 16)) & 0x0000ffff0000ffff;
+            word = (word * (radix_2 * radix_2) + (word >> 32)) & 0xffffffff;
+            value = (std::uint32_t)word;
+            return n;
+        }
+
         template<
             bool Signed,
             int Radix,
@@ -1029,20 +1252,52 @@ namespace boost::parser::detail::numeric {
         {
             if constexpr (use_charconv_int<MinDigits, MaxDigits, I, S>) {
 #if defined(BOOST_PARSER_HAVE_CHARCONV)
-                auto unpacked = text::unpack_iterator_and_sentinel(first, last);
+                char buffer[number_buffer_size];
+                auto const chars = numeric::unpack_to_chars(first, last, buffer);
+                if (chars.complete) {
+                    char const * const number =
+                        numeric::skip_sign<Signed>(chars.first, chars.last);
+                    if (!number)
+                        return false;
 #if defined(BOOST_PARSER_HAVE_STD_CHARCONV)
-                std::from_chars_result const result = std::from_chars(
+                    std::from_chars_result const result = std::from_chars(
 #else
-                charconv::from_chars_result const result = charconv::from_chars(
+                    charconv::from_chars_result const result =
+                        charconv::from_chars(
 #endif
-                    unpacked.first, unpacked.last, attr, Radix);
-                if (result.ec == std::errc()) {
-                    first = unpacked.repack(result.ptr);
-                    return true;
+                        number, chars.last, attr, Radix);
+                    if (result.ec == std::errc()) {
+                        first = chars.repack(result.ptr);
+                        return true;
+                    }
+                    return false;
                 }
-                return false;
 #endif
-            } else if constexpr (Signed) {
+            } else if constexpr (use_swar_uint<
+                                     Signed,
+                                     Radix,
+                                     MaxDigits,
+                                     I,
+                                     S,
+                                     T>) {
+                char buffer[number_buffer_size];
+                auto const chars = numeric::unpack_to_chars(first, last, buffer);
+                if (chars.first == chars.last)
+                    return false;
+                std::uint32_t value;
+                int const digits = parse_digits_swar<Radix, MaxDigits>(
+                    chars.first, chars.last, value);
+                if (digits < MinDigits)
+                    return false;
+                if (value <= std::uint64_t((std::numeric_limits<T>::max)())) {
+                    attr = T(value);
+                    first = chars.repack(chars.first + digits);
+                    return true;
+                }
+                // The value does not fit in T; extract_uint stops at the
+                // digit that overflows.
+            }
+            if constexpr (Signed) {
                 using extract = detail_spirit_x3::
                     extract_int<T, Radix, MinDigits, MaxDigits>;
                 return extract::call(first, last, attr);
@@ -1055,36 +1310,75 @@ namespace boost::parser::detail::numeric {
 
         template<typename I, typename S>
 #if defined(BOOST_PARSER_HAVE_CHARCONV)
-        constexpr bool use_charconv_real =
-            common_range<I, S> && unpacks_to_chars<I, S>;
+        constexpr bool use_charconv_real = unpacks_to_code_units<I, S>;
 #else
         constexpr bool use_charconv_real = false;
 #endif
 
-        template<typename I, typename S, typename T>
+        /** Parses a floating-point number in the syntax described by
+            `Policies`.  Only `float` and `double` support policies other
+            than the defaults. */
+        template<typename Policies, typename I, typename S, typename T>
         bool parse_real(I & first, S last, T & attr)
         {
-            if constexpr (use_charconv_real<I, S>) {
+            if constexpr (is_decimal_float<T>) {
+                // Numbers are ASCII, so they can be parsed from the
+                // underlying code units of transcoded input, and always end
+                // at a code point boundary.
+                if constexpr (unpacks_to_chars<I, S>) {
+                    char buffer[number_buffer_size];
+                    auto const chars =
+                        numeric::unpack_to_chars(first, last, buffer);
+                    char const * it = chars.first;
+                    if (!numeric::parse_decimal_float<Policies>(
+                            it, chars.last, attr)) {
+                        return false;
+                    }
+                    first = chars.repack(it);
+                    return true;
+                } else if constexpr (is_code_unit<text::detail::iter_value_t<
+                                         unpacked_iter<I, S>>>) {
+                    auto const unpacked =
+                        text::unpack_iterator_and_sentinel(first, last);
+                    auto it = unpacked.first;
+                    if (!numeric::parse_decimal_float<Policies>(
+                            it, unpacked.last, attr)) {
+                        return false;
+                    }
+                    first = unpacked.repack(it);
+                    return true;
+                } else {
+                    return numeric::parse_decimal_float<Policies>(
+                        first, last, attr);
+                }
+            } else if constexpr (use_charconv_real<I, S>) {
 #if defined(BOOST_PARSER_HAVE_CHARCONV)
-                auto unpacked = text::unpack_iterator_and_sentinel(first, last);
+                char buffer[number_buffer_size];
+                auto const chars = numeric::unpack_to_chars(first, last, buffer);
+                if (chars.complete) {
+                    char const * const number =
+                        numeric::skip_sign<true>(chars.first, chars.last);
+                    if (!number)
+                        return false;
 #if defined(BOOST_PARSER_HAVE_STD_CHARCONV)
-                std::from_chars_result const result = std::from_chars(
+                    std::from_chars_result const result = std::from_chars(
 #else
-                charconv::from_chars_result const result = charconv::from_chars(
+                    charconv::from_chars_result const result =
+                        charconv::from_chars(
 #endif
-                    unpacked.first, unpacked.last, attr);
-                if (result.ec == std::errc()) {
-                    first = unpacked.repack(result.ptr);
-                    return true;
+                        number, chars.last, attr);
+                    if (result.ec == std::errc()) {
+                        first = chars.repack(result.ptr);
+                        return true;
+                    }
+                    return false;
                 }
-                return false;
 #endif
-            } else {
-                detail_spirit_x3::real_policies<T> policies;
-                using extract = detail_spirit_x3::
-                    extract_real<T, detail_spirit_x3::real_policies<T>>;
-                return extract::parse(first, last, attr, policies);
             }
+            detail_spirit_x3::real_policies<T> policies;
+            using extract = detail_spirit_x3::
+                extract_real<T, detail_spirit_x3::real_policies<T>>;
+            return extract::parse(first, last, attr, policies);
         }
     }
 }
@@ -143,6 +143,13 @@ namespace boost { namespace parser { namespace detail {
         std::ostream & os,
         int components = 0);
 
+    template<typename Context, typename Parser>
+    void print_parser(
+        Context const & context,
+        memoize_parser<Parser> const & parser,
+        std::ostream & os,
+        int components = 0);
+
     template<typename Context, typename Parser, typename SkipParser>
     void print_parser(
         Context const & context,
@@ -280,10 +287,14 @@ namespace boost { namespace parser { namespace detail {
         std::ostream & os,
         int components = 0);
 
-    template<typename Context, typename Quotes, typename Escapes>
+    template<
+        typename Context,
+        typename Quotes,
+        typename Escapes,
+        bool View>
     void print_parser(
         Context const & context,
-        quoted_string_parser<Quotes, Escapes> const & parser,
+        quoted_string_parser<Quotes, Escapes, View> const & parser,
         std::ostream & os,
         int components = 0);
 
@@ -327,10 +338,10 @@ namespace boost { namespace parser { namespace detail {
         std::ostream & os,
         int components = 0);
 
-    template<typename Context, typename T>
+    template<typename Context, typename T, typename Policies>
     void print_parser(
         Context const & context,
-        float_parser<T> const & parser,
+        float_parser<T, Policies> const & parser,
         std::ostream & os,
         int components = 0);
 
@@ -348,6 +359,27 @@ namespace boost { namespace parser { namespace detail {
         std::ostream & os,
         int components = 0);
 
+    template<typename Context>
+    void print_parser(
+        Context const & context,
+        float_parser<double, json_number_policies> const & parser,
+        std::ostream & os,
+        int components = 0);
+
+    template<typename Context>
+    void print_parser(
+        Context const & context,
+        float_parser<double, strict_decimal_policies> const & parser,
+        std::ostream & os,
+        int components = 0);
+
+    template<typename Context>
+    void print_parser(
+        Context const & context,
+        float_parser<double, c_literal_policies> const & parser,
+        std::ostream & os,
+        int components = 0);
+
     template<typename Context, typename SwitchValue, typename OrParser>
     void print_parser(
         Context const & context,
@@ -358,6 +358,17 @@ namespace boost { namespace parser { namespace detail {
             context, "no_case", parser.parser_, os, components);
     }
 
+    template<typename Context, typename Parser>
+    void print_parser(
+        Context const & context,
+        memoize_parser<Parser> const & parser,
+        std::ostream & os,
+        int components)
+    {
+        detail::print_directive(
+            context, "memoize", parser.parser_, os, components);
+    }
+
     template<typename Context, typename Parser, typename SkipParser>
     void print_parser(
         Context const & context,
@@ -695,14 +706,18 @@ namespace boost { namespace parser { namespace detail {
         os << "\"";
     }
 
-    template<typename Context, typename Quotes, typename Escapes>
+    template<
+        typename Context,
+        typename Quotes,
+        typename Escapes,
+        bool View>
     void print_parser(
         Context const & context,
-        quoted_string_parser<Quotes, Escapes> const & parser,
+        quoted_string_parser<Quotes, Escapes, View> const & parser,
         std::ostream & os,
         int components)
     {
-        os << "quoted_string(";
+        os << (View ? "quoted_string_view(" : "quoted_string(");
         if constexpr (is_nope_v<Quotes>) {
             detail::print_expected_char_impl<Context, char32_t>::call(
                 context, os, parser.ch_);
@@ -852,14 +867,17 @@ namespace boost { namespace parser { namespace detail {
         os << "long_long";
     }
 
-    template<typename Context, typename T>
+    template<typename Context, typename T, typename Policies>
     void print_parser(
         Context const & context,
-        float_parser<T> const & parser,
+        float_parser<T, Policies> const & parser,
         std::ostream & os,
         int components)
     {
-        os << "float<" << detail::type_name<T>() << ">";
+        os << "float<" << detail::type_name<T>();
+        if constexpr (!std::is_same_v<Policies, float_policies>)
+            os << ", " << detail::type_name<Policies>();
+        os << ">";
     }
 
     template<typename Context>
@@ -882,6 +900,36 @@ namespace boost { namespace parser { namespace detail {
         os << "double_";
     }
 
+    template<typename Context>
+    void print_parser(
+        Context const & context,
+        float_parser<double, json_number_policies> const & parser,
+        std::ostream & os,
+        int components)
+    {
+        os << "json_number";
+    }
+
+    template<typename Context>
+    void print_parser(
+        Context const & context,
+        float_parser<double, strict_decimal_policies> const & parser,
+        std::ostream & os,
+        int components)
+    {
+        os << "strict_decimal";
+    }
+
+    template<typename Context>
+    void print_parser(
+        Context const & context,
+        float_parser<double, c_literal_policies> const & parser,
+        std::ostream & os,
+        int components)
+    {
+        os << "c_literal";
+    }
+
     template<
         typename Context,
         typename ParserTuple,
@@ -0,0 +1,407 @@
+// Copyright (C) 2024 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_PARSER_DETAIL_SIMD_HPP
+#define BOOST_PARSER_DETAIL_SIMD_HPP
+
+#include <boost/parser/config.hpp>
+
+#if BOOST_PARSER_USE_AVX2
+#include <immintrin.h>
+#elif BOOST_PARSER_USE_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Runs of decimal or hex digits are parsed eight chars at a time, in a
+// 64-bit word whose lowest byte is the first char; that is only a plain load
+// on little-endian targets.
+#if !defined(BOOST_PARSER_DISABLE_SIMD) &&                                     \
+    (defined(_MSC_VER) || (defined(__BYTE_ORDER__) &&                          \
+                           __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__))
+#define BOOST_PARSER_USE_SWAR_DIGITS 1
+#else
+#define BOOST_PARSER_USE_SWAR_DIGITS 0
+#endif
+
+
+namespace boost::parser::detail::simd {
+
+    /** The number of bytes processed at once by the widest vector
+        operations in use; 1 when no SIMD instruction set is available. */
+#if BOOST_PARSER_USE_AVX2
+    inline constexpr int block_bytes = 32;
+#elif BOOST_PARSER_USE_SSE2
+    inline constexpr int block_bytes = 16;
+#else
+    inline constexpr int block_bytes = 1;
+#endif
+
+    inline int countr_zero(std::uint32_t x) noexcept
+    {
+        BOOST_PARSER_DEBUG_ASSERT(x);
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long retval;
+        _BitScanForward(&retval, x);
+        return (int)retval;
+#else
+        return __builtin_ctz(x);
+#endif
+    }
+
+    inline int countr_zero(std::uint64_t x) noexcept
+    {
+        BOOST_PARSER_DEBUG_ASSERT(x);
+#if defined(_MSC_VER) && !defined(__clang__)
+        std::uint32_t const lo = (std::uint32_t)x;
+        return lo ? countr_zero(lo) : 32 + countr_zero(std::uint32_t(x >> 32));
+#else
+        return __builtin_ctzll(x);
+#endif
+    }
+
+    inline int countl_zero(std::uint64_t x) noexcept
+    {
+        BOOST_PARSER_DEBUG_ASSERT(x);
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long retval;
+        std::uint32_t const hi = std::uint32_t(x >> 32);
+        if (hi) {
+            _BitScanReverse(&retval, hi);
+            return 31 - (int)retval;
+        }
+        _BitScanReverse(&retval, (std::uint32_t)x);
+        return 63 - (int)retval;
+#else
+        return __builtin_clzll(x);
+#endif
+    }
+
+    /** True iff find_in_padded() can search a sequence of `T` a vector
+        block at a time. */
+    template<typename T>
+    constexpr bool can_find_in_padded =
+        1 < block_bytes && std::is_integral_v<T> &&
+        (sizeof(T) == 1 || sizeof(T) == 4);
+
+    /** Returns the index of the first element of `[first, first + n)` that
+        is equal to `x`, or `n` if there is no such element.  The search
+        reads whole vector blocks, so the elements up to the next multiple
+        of `block_bytes` past `first + n` must be readable; their values are
+        ignored. */
+    template<typename T>
+    int find_in_padded(T const * first, int n, T x) noexcept
+    {
+        static_assert(can_find_in_padded<T>);
+        constexpr int per_block = block_bytes / (int)sizeof(T);
+        for (int i = 0; i < n; i += per_block, first += per_block) {
+#if BOOST_PARSER_USE_AVX2
+            __m256i const block =
+                _mm256_loadu_si256(reinterpret_cast<__m256i const *>(first));
+            __m256i const eq =
+                sizeof(T) == 1
+                    ? _mm256_cmpeq_epi8(block, _mm256_set1_epi8((char)x))
+                    : _mm256_cmpeq_epi32(block, _mm256_set1_epi32((int)x));
+            std::uint32_t mask = (std::uint32_t)_mm256_movemask_epi8(eq);
+#elif BOOST_PARSER_USE_SSE2
+            __m128i const block =
+                _mm_loadu_si128(reinterpret_cast<__m128i const *>(first));
+            __m128i const eq =
+                sizeof(T) == 1
+                    ? _mm_cmpeq_epi8(block, _mm_set1_epi8((char)x))
+                    : _mm_cmpeq_epi32(block, _mm_set1_epi32((int)x));
+            std::uint32_t mask = (std::uint32_t)_mm_movemask_epi8(eq);
+#else
+            std::uint32_t mask = 0;
+#endif
+            int const remaining = n - i;
+            if (remaining < per_block)
+                mask &= (std::uint32_t(1) << (remaining * sizeof(T))) - 1;
+            if (mask)
+                return i + countr_zero(mask) / (int)sizeof(T);
+        }
+        return n;
+    }
+
+
+    /** A set of ASCII bytes, as at most `capacity` closed ranges
+        `[lo_[i], hi_[i]]`. */
+    struct byte_ranges
+    {
+        static constexpr int capacity = 4;
+
+        int size_ = 0;
+        char lo_[capacity] = {};
+        char hi_[capacity] = {};
+    };
+
+    /** Returns the number of elements at the start of `[first, first + n)`
+        that are each within one of `ranges`.  Bytes outside of the ASCII
+        range are never within `ranges`.  Unlike find_in_padded(), this
+        never reads past `first + n`. */
+    inline std::ptrdiff_t span_in_ranges(
+        char const * first,
+        std::ptrdiff_t n,
+        byte_ranges const & ranges) noexcept
+    {
+        std::ptrdiff_t i = 0;
+#if BOOST_PARSER_USE_AVX2
+        for (; i + block_bytes <= n; i += block_bytes) {
+            __m256i const block = _mm256_loadu_si256(
+                reinterpret_cast<__m256i const *>(first + i));
+            // Non-ASCII bytes are negative, and so always below lo.
+            __m256i out = _mm256_set1_epi8(-1);
+            for (int j = 0; j < ranges.size_; ++j) {
+                out = _mm256_and_si256(
+                    out,
+                    _mm256_or_si256(
+                        _mm256_cmpgt_epi8(
+                            _mm256_set1_epi8(ranges.lo_[j]), block),
+                        _mm256_cmpgt_epi8(
+                            block, _mm256_set1_epi8(ranges.hi_[j]))));
+            }
+            std::uint32_t const mask = (std::uint32_t)_mm256_movemask_epi8(out);
+            if (mask)
+                return i + countr_zero(mask);
+        }
+#elif BOOST_PARSER_USE_SSE2
+        for (; i + block_bytes <= n; i += block_bytes) {
+            __m128i const block =
+                _mm_loadu_si128(reinterpret_cast<__m128i const *>(first + i));
+            // Non-ASCII bytes are negative, and so always below lo.
+            __m128i out = _mm_set1_epi8(-1);
+            for (int j = 0; j < ranges.size_; ++j) {
+                out = _mm_and_si128(
+                    out,
+                    _mm_or_si128(
+                        _mm_cmplt_epi8(block, _mm_set1_epi8(ranges.lo_[j])),
+                        _mm_cmpgt_epi8(block, _mm_set1_epi8(ranges.hi_[j]))));
+            }
+            std::uint32_t const mask = (std::uint32_t)_mm_movemask_epi8(out);
+            if (mask)
+                return i + countr_zero(mask);
+        }
+#endif
+        for (; i < n; ++i) {
+            char const c = first[i];
+            bool in = false;
+            for (int j = 0; j < ranges.size_; ++j) {
+                in |= 0 <= c && ranges.lo_[j] <= c && c <= ranges.hi_[j];
+            }
+            if (!in)
+                break;
+        }
+        return i;
+    }
+
+    /** Returns the number of ASCII bytes at the start of `[first, first +
+        n)`.  This never reads past `first + n`. */
+    inline std::ptrdiff_t
+    ascii_prefix(char const * first, std::ptrdiff_t n) noexcept
+    {
+        std::ptrdiff_t i = 0;
+#if BOOST_PARSER_USE_AVX2
+        for (; i + block_bytes <= n; i += block_bytes) {
+            std::uint32_t const mask = (std::uint32_t)_mm256_movemask_epi8(
+                _mm256_loadu_si256(
+                    reinterpret_cast<__m256i const *>(first + i)));
+            if (mask)
+                return i + countr_zero(mask);
+        }
+#elif BOOST_PARSER_USE_SSE2
+        for (; i + block_bytes <= n; i += block_bytes) {
+            std::uint32_t const mask = (std::uint32_t)_mm_movemask_epi8(
+                _mm_loadu_si128(reinterpret_cast<__m128i const *>(first + i)));
+            if (mask)
+                return i + countr_zero(mask);
+        }
+#else
+        constexpr std::uint64_t highs = 0x8080808080808080;
+        for (; i + 8 <= n; i += 8) {
+            std::uint64_t word;
+            std::memcpy(&word, first + i, 8);
+            if (word & highs)
+                break;
+        }
+#endif
+        for (; i < n; ++i) {
+            if (first[i] & 0x80)
+                break;
+        }
+        return i;
+    }
+
+    /** Returns the number of elements less than 0x80 at the start of
+        `[first, first + n)`, where `T` is a 32-bit integral type.  This
+        never reads past `first + n`. */
+    template<typename T>
+    std::ptrdiff_t ascii_prefix_32(T const * first, std::ptrdiff_t n) noexcept
+    {
+        static_assert(std::is_integral_v<T> && sizeof(T) == 4);
+        std::ptrdiff_t i = 0;
+#if BOOST_PARSER_USE_AVX2 || BOOST_PARSER_USE_SSE2
+        // The signed saturating packs keep each element's bits above 0x7f
+        // nonzero iff they were nonzero, leaving one byte per element.
+        __m128i const non_ascii = _mm_set1_epi32(~0x7f);
+        for (; i + 16 <= n; i += 16) {
+            __m128i const * const block =
+                reinterpret_cast<__m128i const *>(first + i);
+            __m128i const lo = _mm_packs_epi32(
+                _mm_and_si128(_mm_loadu_si128(block), non_ascii),
+                _mm_and_si128(_mm_loadu_si128(block + 1), non_ascii));
+            __m128i const hi = _mm_packs_epi32(
+                _mm_and_si128(_mm_loadu_si128(block + 2), non_ascii),
+                _mm_and_si128(_mm_loadu_si128(block + 3), non_ascii));
+            __m128i const eq =
+                _mm_cmpeq_epi8(_mm_packs_epi16(lo, hi), _mm_setzero_si128());
+            std::uint32_t const mask =
+                ~(std::uint32_t)_mm_movemask_epi8(eq) & 0xffff;
+            if (mask)
+                return i + countr_zero(mask);
+        }
+#endif
+        for (; i < n; ++i) {
+            if (std::uint32_t(first[i]) & ~std::uint32_t(0x7f))
+                break;
+        }
+        return i;
+    }
+
+    /** Copies the `n` ASCII bytes at `first` to the elements at `out`, where
+        `T` is a 16- or 32-bit integral type. */
+    template<typename T>
+    void widen_ascii(char const * first, std::ptrdiff_t n, T * out) noexcept
+    {
+        static_assert(
+            std::is_integral_v<T> && (sizeof(T) == 2 || sizeof(T) == 4));
+        std::ptrdiff_t i = 0;
+#if BOOST_PARSER_USE_AVX2
+        for (; i + 16 <= n; i += 16) {
+            __m128i const block =
+                _mm_loadu_si128(reinterpret_cast<__m128i const *>(first + i));
+            __m256i * const dest = reinterpret_cast<__m256i *>(out + i);
+            if constexpr (sizeof(T) == 2) {
+                _mm256_storeu_si256(dest, _mm256_cvtepu8_epi16(block));
+            } else {
+                _mm256_storeu_si256(dest, _mm256_cvtepu8_epi32(block));
+                _mm256_storeu_si256(
+                    dest + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(block, 8)));
+            }
+        }
+#elif BOOST_PARSER_USE_SSE2
+        __m128i const zero = _mm_setzero_si128();
+        for (; i + 16 <= n; i += 16) {
+            __m128i const block =
+                _mm_loadu_si128(reinterpret_cast<__m128i const *>(first + i));
+            __m128i const lo = _mm_unpacklo_epi8(block, zero);
+            __m128i const hi = _mm_unpackhi_epi8(block, zero);
+            __m128i * const dest = reinterpret_cast<__m128i *>(out + i);
+            if constexpr (sizeof(T) == 2) {
+                _mm_storeu_si128(dest, lo);
+                _mm_storeu_si128(dest + 1, hi);
+            } else {
+                _mm_storeu_si128(dest, _mm_unpacklo_epi16(lo, zero));
+                _mm_storeu_si128(dest + 1, _mm_unpackhi_epi16(lo, zero));
+                _mm_storeu_si128(dest + 2, _mm_unpacklo_epi16(hi, zero));
+                _mm_storeu_si128(dest + 3, _mm_unpackhi_epi16(hi, zero));
+            }
+        }
+#endif
+        for (; i < n; ++i) {
+            out[i] = T(first[i]);
+        }
+    }
+
+    /** Copies the `n` ASCII values at `first` to the bytes at `out`, where
+        `T` is a 32-bit integral type. */
+    template<typename T>
+    void narrow_ascii(T const * first, std::ptrdiff_t n, char * out) noexcept
+    {
+        static_assert(std::is_integral_v<T> && sizeof(T) == 4);
+        std::ptrdiff_t i = 0;
+#if BOOST_PARSER_USE_AVX2 || BOOST_PARSER_USE_SSE2
+        // The signed saturating packs are exact, since every value is
+        // below 0x80.
+        for (; i + 16 <= n; i += 16) {
+            __m128i const * const block =
+                reinterpret_cast<__m128i const *>(first + i);
+            __m128i const lo = _mm_packs_epi32(
+                _mm_loadu_si128(block), _mm_loadu_si128(block + 1));
+            __m128i const hi = _mm_packs_epi32(
+                _mm_loadu_si128(block + 2), _mm_loadu_si128(block + 3));
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i *>(out + i), _mm_packs_epi16(lo, hi));
+        }
+#endif
+        for (; i < n; ++i) {
+            out[i] = char(first[i]);
+        }
+    }
+
+    /** Returns the index of the first element of `[first, first + n)` that
+        is equal to `x` or `y`, or `n` if there is no such element.  This
+        never reads past `first + n`. */
+    inline std::ptrdiff_t
+    find_either(char const * first, std::ptrdiff_t n, char x, char y) noexcept
+    {
+        std::ptrdiff_t i = 0;
+#if BOOST_PARSER_USE_AVX2
+        __m256i const xs = _mm256_set1_epi8(x);
+        __m256i const ys = _mm256_set1_epi8(y);
+        for (; i + block_bytes <= n; i += block_bytes) {
+            __m256i const block = _mm256_loadu_si256(
+                reinterpret_cast<__m256i const *>(first + i));
+            std::uint32_t const mask = (std::uint32_t)_mm256_movemask_epi8(
+                _mm256_or_si256(
+                    _mm256_cmpeq_epi8(block, xs),
+                    _mm256_cmpeq_epi8(block, ys)));
+            if (mask)
+                return i + countr_zero(mask);
+        }
+#elif BOOST_PARSER_USE_SSE2
+        __m128i const xs = _mm_set1_epi8(x);
+        __m128i const ys = _mm_set1_epi8(y);
+        for (; i + block_bytes <= n; i += block_bytes) {
+            __m128i const block =
+                _mm_loadu_si128(reinterpret_cast<__m128i const *>(first + i));
+            std::uint32_t const mask = (std::uint32_t)_mm_movemask_epi8(
+                _mm_or_si128(
+                    _mm_cmpeq_epi8(block, xs), _mm_cmpeq_epi8(block, ys)));
+            if (mask)
+                return i + countr_zero(mask);
+        }
+#else
+        // Eight bytes at a time, using the usual has-a-zero-byte test on the
+        // bytes XORed with x and y; the loop below finds the exact index.
+        constexpr std::uint64_t ones = 0x0101010101010101;
+        constexpr std::uint64_t highs = 0x8080808080808080;
+        std::uint64_t const xs = ones * (unsigned char)x;
+        std::uint64_t const ys = ones * (unsigned char)y;
+        for (; i + 8 <= n; i += 8) {
+            std::uint64_t word;
+            std::memcpy(&word, first + i, 8);
+            std::uint64_t const wx = word ^ xs;
+            std::uint64_t const wy = word ^ ys;
+            if (((wx - ones) & ~wx & highs) | ((wy - ones) & ~wy & highs))
+                break;
+        }
+#endif
+        for (; i < n; ++i) {
+            if (first[i] == x || first[i] == y)
+                break;
+        }
+        return i;
+    }
+
+}
+
+#endif
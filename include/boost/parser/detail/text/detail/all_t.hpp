@@ -46,6 +46,7 @@ namespace boost::parser::detail::text::detail {
         std::ranges::view<R>
 #else
         range_<R> && !container_<R> &&
+        std::is_copy_constructible_v<std::remove_reference_t<R>> &&
         !std::is_array_v<std::remove_reference_t<R>> &&
         !is_std_array_v<std::remove_reference_t<R>>
 #endif
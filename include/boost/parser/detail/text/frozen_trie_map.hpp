@@ -0,0 +1,237 @@
+// Copyright (C) 2024 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_PARSER_DETAIL_TEXT_FROZEN_TRIE_MAP_HPP
+#define BOOST_PARSER_DETAIL_TEXT_FROZEN_TRIE_MAP_HPP
+
+#include <boost/parser/detail/simd.hpp>
+#include <boost/parser/detail/text/trie_map.hpp>
+
+#include <cstdint>
+#include <deque>
+
+
+namespace boost::parser::detail { namespace text {
+
+    /** An immutable, compact copy of a trie_map.
+
+        The nodes are stored in breadth-first order in a single array, so the
+        children of each node occupy a contiguous subrange of that array.
+        The key element that leads to each node is stored at the same index
+        in a parallel array, so searching a node's children is a search over
+        a contiguous block of key elements.  Nodes refer to each other and to
+        their values by 32-bit index, rather than by pointer.
+
+        When the key elements are 8- or 32-bit integers compared with
+        `less`, nodes with up to `simd_search_max_children` children are
+        searched with vector compares (where SSE2 or AVX2 is available),
+        instead of by binary search.
+
+        A frozen_trie_map supports the read-only lookup operations of
+        trie_map; to change its contents, thaw() it, modify the resulting
+        trie_map, and freeze that again.
+
+        \param Key The key-type; must be a sequence of values comparable via
+        Compare()(x, y).
+        \param Value The value-type.
+        \param Compare The type of the comparison object used to compare
+        elements of the key-type.
+    */
+    template<typename Key, typename Value, typename Compare = less>
+    struct frozen_trie_map
+    {
+        using key_type = Key;
+        using mapped_type = Value;
+        using key_compare = Compare;
+        using key_element_type = typename Key::value_type;
+
+        using size_type = std::ptrdiff_t;
+        using match_result = trie_match_result;
+
+        frozen_trie_map() : nodes_(1) {}
+
+        explicit frozen_trie_map(trie_map<Key, Value, Compare> const & trie) :
+            comp_(trie.key_comp())
+        {
+            std::deque<match_result> queue;
+            queue.push_back(trie.longest_subsequence(Key()));
+            nodes_.push_back(node_t{});
+            keys_.push_back(key_element_type());
+
+            std::vector<key_element_type> next_elements;
+            for (std::uint32_t i = 0; !queue.empty(); ++i) {
+                match_result const match = queue.front();
+                queue.pop_front();
+
+                if (match.match) {
+                    nodes_[i].value_ = (std::uint32_t)values_.size();
+                    values_.push_back(*trie[match]);
+                }
+
+                next_elements.clear();
+                trie.copy_next_key_elements(
+                    match, std::back_inserter(next_elements));
+                nodes_[i].first_child_ = (std::uint32_t)nodes_.size();
+                nodes_[i].children_ = (std::uint32_t)next_elements.size();
+                for (auto e : next_elements) {
+                    queue.push_back(trie.extend_subsequence(match, e));
+                    nodes_.push_back(node_t{});
+                    keys_.push_back(e);
+                }
+            }
+
+            // find_in_padded() may read a partial block past the last key.
+            if constexpr (simd_search) {
+                keys_.resize(
+                    keys_.size() +
+                    parser::detail::simd::block_bytes / sizeof(key_element_type));
+            }
+        }
+
+        bool empty() const { return values_.empty(); }
+        size_type size() const { return (size_type)values_.size(); }
+
+        key_compare key_comp() const { return comp_; }
+
+        /** Returns the longest matching subsequence of `[first, last)` found
+            in *this. */
+        template<typename KeyIter, typename Sentinel>
+        match_result longest_match(KeyIter first, Sentinel last) const
+        {
+            node_t const * node = nodes_.data();
+            match_result retval(
+                node, 0, node->value_ != no_index, !node->children_);
+            for (size_type size = 1; first != last; ++first, ++size) {
+                std::uint32_t const child = find_child(*node, *first);
+                if (child == no_index)
+                    break;
+                node = nodes_.data() + child;
+                if (node->value_ != no_index)
+                    retval = match_result(node, size, true, !node->children_);
+            }
+            return retval;
+        }
+
+        /** Returns the longest matching subsequence of `key` found in
+            *this. */
+        template<typename KeyRange>
+        match_result longest_match(KeyRange const & key) const
+        {
+            return longest_match(detail::begin(key), detail::end(key));
+        }
+
+        /** Returns an optional reference to the const value associated with
+            `key` in *this (if any). */
+        template<typename KeyRange>
+        optional_ref<mapped_type const> operator[](KeyRange const & key) const
+        {
+            auto first = detail::begin(key);
+            auto const last = detail::end(key);
+            node_t const * node = nodes_.data();
+            for (; first != last; ++first) {
+                std::uint32_t const child = find_child(*node, *first);
+                if (child == no_index)
+                    return {};
+                node = nodes_.data() + child;
+            }
+            if (node->value_ == no_index)
+                return {};
+            return values_[node->value_];
+        }
+
+        /** Returns an optional reference to the const value associated with
+            `match` in *this (if any). */
+        optional_ref<mapped_type const> operator[](match_result match) const
+        {
+            if (!match.match)
+                return {};
+            return values_[static_cast<node_t const *>(match.node)->value_];
+        }
+
+        /** Calls `f(key, value)` for each element of *this, in key order.
+            `key` is a `Key const &`, only valid for the duration of the
+            call. */
+        template<typename F>
+        void for_each(F && f) const
+        {
+            Key key;
+            for_each_impl(nodes_.front(), key, f);
+        }
+
+        /** Returns a trie_map with the same contents as *this. */
+        trie_map<Key, Value, Compare> thaw() const
+        {
+            trie_map<Key, Value, Compare> retval(comp_);
+            for_each([&retval](Key const & key, Value const & value) {
+                retval.insert(key, value);
+            });
+            return retval;
+        }
+
+    private:
+        static constexpr std::uint32_t no_index = std::uint32_t(-1);
+
+        static constexpr bool simd_search =
+            std::is_same_v<Compare, less> &&
+            parser::detail::simd::can_find_in_padded<key_element_type>;
+        // Past this many children, binary search wins over a linear vector
+        // search.
+        static constexpr std::uint32_t simd_search_max_children =
+            8 * parser::detail::simd::block_bytes / sizeof(key_element_type);
+
+        struct node_t
+        {
+            std::uint32_t first_child_ = 0;
+            std::uint32_t children_ = 0;
+            std::uint32_t value_ = no_index;
+        };
+
+        std::uint32_t find_child(node_t const & node, key_element_type e) const
+        {
+            if constexpr (simd_search) {
+                if (node.children_ <= simd_search_max_children) {
+                    int const i = parser::detail::simd::find_in_padded(
+                        keys_.data() + node.first_child_,
+                        (int)node.children_,
+                        e);
+                    if (i == (int)node.children_)
+                        return no_index;
+                    return node.first_child_ + i;
+                }
+            }
+            auto const first = keys_.begin() + node.first_child_;
+            auto const last = first + node.children_;
+            auto const it = std::lower_bound(first, last, e, comp_);
+            if (it == last || comp_(e, *it))
+                return no_index;
+            return std::uint32_t(it - keys_.begin());
+        }
+
+        template<typename F>
+        void for_each_impl(node_t const & node, Key & key, F & f) const
+        {
+            if (node.value_ != no_index)
+                f(const_cast<Key const &>(key), values_[node.value_]);
+            for (std::uint32_t i = node.first_child_,
+                               end = node.first_child_ + node.children_;
+                 i < end;
+                 ++i) {
+                key.insert(key.end(), keys_[i]);
+                for_each_impl(nodes_[i], key, f);
+                key.erase(std::prev(key.end()));
+            }
+        }
+
+        std::vector<node_t> nodes_;
+        // keys_[i] is the key element that leads from the parent of
+        // nodes_[i] to nodes_[i]; keys_[0] is unused.
+        std::vector<key_element_type> keys_;
+        std::vector<Value> values_;
+        Compare comp_;
+    };
+
+}}
+
+#endif
@@ -10,9 +10,7 @@
 #include <boost/parser/detail/text/in_out_result.hpp>
 #include <boost/parser/detail/text/transcode_iterator.hpp>
 #include <boost/parser/detail/text/unpack.hpp>
-#if BOOST_PARSER_DETAIL_TEXT_USE_CONCEPTS
 #include <algorithm>
-#endif
 
 #include <boost/parser/config.hpp>
 
@@ -74,6 +72,60 @@ namespace boost::parser::detail { namespace text {
             return out;
         }
 
+        // The contiguous transcoding loops go one code point at a time
+        // until they have seen this many ASCII code units in a row, and then
+        // copy the rest of the run of ASCII at once; text with only short
+        // runs of ASCII never pays for looking for the end of a run.
+        inline constexpr std::ptrdiff_t ascii_run_threshold = 16;
+
+        // Returns the number of ASCII code units at the start of the
+        // contiguous range [first, last), or of its first n code units if
+        // UseN.
+        template<bool UseN, typename Iter>
+        std::ptrdiff_t ascii_run(Iter first, Iter last, std::ptrdiff_t n)
+        {
+            std::ptrdiff_t len = last - first;
+            if constexpr (UseN)
+                len = (std::min)(len, n);
+            auto const ptr = detail::contiguous_address(first);
+            if constexpr (sizeof(*ptr) == 1) {
+                return simd::ascii_prefix(
+                    reinterpret_cast<char const *>(ptr), len);
+            } else {
+                return simd::ascii_prefix_32(ptr, len);
+            }
+        }
+
+        // Copies the n ASCII code units at first to out.  When out is a
+        // pointer, the copy widens or narrows a vector block at a time.
+        template<typename T, typename OutIter>
+        OutIter copy_ascii(T const * first, std::ptrdiff_t n, OutIter out)
+        {
+            if constexpr (std::is_pointer_v<OutIter>) {
+                using out_type = std::remove_pointer_t<OutIter>;
+                if constexpr (
+                    sizeof(T) == 1 && std::is_integral_v<out_type> &&
+                    (sizeof(out_type) == 2 || sizeof(out_type) == 4)) {
+                    simd::widen_ascii(
+                        reinterpret_cast<char const *>(first), n, out);
+                    return out + n;
+                } else if constexpr (
+                    sizeof(T) == 4 && std::is_integral_v<out_type> &&
+                    sizeof(out_type) == 1) {
+                    simd::narrow_ascii(
+                        first, n, reinterpret_cast<char *>(out));
+                    return out + n;
+                }
+            }
+            for (std::ptrdiff_t i = 0; i < n; ++i, ++out) {
+                if constexpr (sizeof(T) == 1)
+                    *out = first[i];
+                else
+                    *out = static_cast<char>(first[i]);
+            }
+            return out;
+        }
+
         template<
             bool UseN,
             typename InputIter,
@@ -108,8 +160,38 @@ namespace boost::parser::detail { namespace text {
             OutIter out,
             std::random_access_iterator_tag)
         {
-            return transcode_utf_8_to_16<UseN>(
-                first, last, n, out, std::input_iterator_tag{});
+            if constexpr (is_contiguous_byte_iter_v<Iter>) {
+                std::ptrdiff_t ascii_seen = 0;
+                while (first != last && (!UseN || n)) {
+                    unsigned char const c = *first;
+                    if (c < 0x80) {
+                        if (ascii_seen < ascii_run_threshold) {
+                            *out = *first;
+                            ++first;
+                            ++out;
+                            --n;
+                            ++ascii_seen;
+                        } else {
+                            auto const ascii =
+                                detail::ascii_run<UseN>(first, last, n);
+                            out = detail::copy_ascii(
+                                detail::contiguous_address(first), ascii, out);
+                            first += ascii;
+                            n -= ascii;
+                            ascii_seen = 0;
+                        }
+                    } else {
+                        auto const cp = detail::advance(first, last);
+                        out = detail::read_into_utf16_iter(cp, out);
+                        --n;
+                        ascii_seen = 0;
+                    }
+                }
+                return {first, out};
+            } else {
+                return transcode_utf_8_to_16<UseN>(
+                    first, last, n, out, std::input_iterator_tag{});
+            }
         }
 
         template<
@@ -146,8 +228,38 @@ namespace boost::parser::detail { namespace text {
             OutIter out,
             std::random_access_iterator_tag)
         {
-            return transcode_utf_8_to_32<UseN>(
-                first, last, n, out, std::input_iterator_tag{});
+            if constexpr (is_contiguous_byte_iter_v<Iter>) {
+                std::ptrdiff_t ascii_seen = 0;
+                while (first != last && (!UseN || n)) {
+                    unsigned char const c = *first;
+                    if (c < 0x80) {
+                        if (ascii_seen < ascii_run_threshold) {
+                            *out = *first;
+                            ++first;
+                            ++out;
+                            --n;
+                            ++ascii_seen;
+                        } else {
+                            auto const ascii =
+                                detail::ascii_run<UseN>(first, last, n);
+                            out = detail::copy_ascii(
+                                detail::contiguous_address(first), ascii, out);
+                            first += ascii;
+                            n -= ascii;
+                            ascii_seen = 0;
+                        }
+                    } else {
+                        *out = detail::advance(first, last);
+                        ++out;
+                        --n;
+                        ascii_seen = 0;
+                    }
+                }
+                return {first, out};
+            } else {
+                return transcode_utf_8_to_32<UseN>(
+                    first, last, n, out, std::input_iterator_tag{});
+            }
         }
 
         template<format Tag>
@@ -308,10 +420,42 @@ namespace boost::parser::detail { namespace text {
             std::ptrdiff_t n,
             OutIter out)
         {
-            for (; first != last && (!UseN || n); ++first, --n) {
-                out = detail::read_into_utf8_iter(*first, out);
+            if constexpr (
+                std::is_same_v<Iter, Sentinel> &&
+                is_contiguous_code_unit_iter_v<Iter, 4>) {
+                std::ptrdiff_t ascii_seen = 0;
+                while (first != last && (!UseN || n)) {
+                    uint32_t const cp = *first;
+                    if (cp < 0x80) {
+                        if (ascii_seen < ascii_run_threshold) {
+                            *out = static_cast<char>(cp);
+                            ++first;
+                            ++out;
+                            --n;
+                            ++ascii_seen;
+                        } else {
+                            auto const ascii =
+                                detail::ascii_run<UseN>(first, last, n);
+                            out = detail::copy_ascii(
+                                detail::contiguous_address(first), ascii, out);
+                            first += ascii;
+                            n -= ascii;
+                            ascii_seen = 0;
+                        }
+                    } else {
+                        out = detail::read_into_utf8_iter(cp, out);
+                        ++first;
+                        --n;
+                        ascii_seen = 0;
+                    }
+                }
+                return {first, out};
+            } else {
+                for (; first != last && (!UseN || n); ++first, --n) {
+                    out = detail::read_into_utf8_iter(*first, out);
+                }
+                return {first, out};
             }
-            return {first, out};
         }
 
         template<bool UseN, typename Iter, typename Sentinel, typename OutIter>
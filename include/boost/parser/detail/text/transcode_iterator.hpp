@@ -7,6 +7,7 @@
 #define BOOST_PARSER_DETAIL_TEXT_TRANSCODE_ITERATOR_HPP
 
 #include <boost/parser/detail/debug_assert.hpp>
+#include <boost/parser/detail/simd.hpp>
 #include <boost/parser/detail/text/transcode_iterator_fwd.hpp>
 #include <boost/parser/detail/text/concepts.hpp>
 #include <boost/parser/detail/text/utf.hpp>
@@ -16,9 +17,12 @@
 
 #include <array>
 #include <iterator>
+#include <memory>
 #include <type_traits>
 #include <stdexcept>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace boost::parser::detail { namespace text {
 
@@ -38,6 +42,52 @@ namespace boost::parser::detail { namespace text {
             return lo <= c && c <= hi;
         }
 
+#if !BOOST_PARSER_DETAIL_TEXT_USE_CONCEPTS
+        template<typename I, typename CharT>
+        constexpr bool is_string_iter_of_v =
+            std::is_same_v<I, typename std::basic_string<CharT>::iterator> ||
+            std::is_same_v<
+                I,
+                typename std::basic_string<CharT>::const_iterator> ||
+            std::is_same_v<
+                I,
+                typename std::basic_string_view<CharT>::const_iterator>;
+#endif
+
+        template<typename I, std::size_t Size>
+        constexpr bool is_contiguous_code_unit_iter_v =
+#if BOOST_PARSER_DETAIL_TEXT_USE_CONCEPTS
+            std::contiguous_iterator<I> &&
+#else
+            (std::is_pointer_v<I> || is_string_iter_of_v<I, char> ||
+             is_string_iter_of_v<I, char16_t> ||
+             is_string_iter_of_v<I, char32_t> ||
+             std::is_same_v<
+                 I,
+                 typename std::vector<iter_value_t<I>>::iterator> ||
+             std::is_same_v<
+                 I,
+                 typename std::vector<iter_value_t<I>>::const_iterator>) &&
+#endif
+            std::is_integral_v<iter_value_t<I>> &&
+            sizeof(iter_value_t<I>) == Size;
+
+        template<typename I>
+        constexpr bool is_contiguous_byte_iter_v =
+            is_contiguous_code_unit_iter_v<I, 1>;
+
+        /** Returns a pointer to the element at `it`, which must be a
+            contiguous iterator. */
+        template<typename I>
+        constexpr auto contiguous_address(I it)
+        {
+#if BOOST_PARSER_DETAIL_TEXT_USE_CONCEPTS
+            return std::to_address(it);
+#else
+            return std::addressof(*it);
+#endif
+        }
+
         struct throw_on_encoding_error
         {};
 
@@ -2730,6 +2780,14 @@ namespace boost::parser::detail { namespace text {
         constexpr utf_iterator & operator++()
         {
             BOOST_PARSER_DEBUG_ASSERT(buf_index_ != buf_last_ || curr() != last_);
+            if constexpr (use_ascii_runs) {
+                if (ascii_ahead_) {
+                    ++curr();
+                    --ascii_ahead_;
+                    buf_[0] = value_type(*curr());
+                    return *this;
+                }
+            }
             if (buf_index_ + 1 == buf_last_ && curr() != last_) {
                 if constexpr (
 #if BOOST_PARSER_DETAIL_TEXT_USE_CONCEPTS
@@ -2837,6 +2895,30 @@ namespace boost::parser::detail { namespace text {
         using base_type::operator--;
 
     private:
+        // For UTF-8 in contiguous storage, the length of the run of ASCII
+        // code units after an ASCII code point is found a vector block at a
+        // time, and recorded in ascii_ahead_; incrementing through the run
+        // then involves no decoding.
+        static constexpr bool use_ascii_runs =
+            FromFormat == format::utf8 && std::is_same_v<I, S> &&
+            detail::is_contiguous_byte_iter_v<I>;
+
+        constexpr void find_ascii_run()
+        {
+            ascii_ahead_ = 0;
+#if defined(__cpp_lib_is_constant_evaluated)
+            if (std::is_constant_evaluated())
+                return;
+#endif
+            if (to_increment_ != 1 || 0x80 <= buf_[0])
+                return;
+            char const * const ptr = reinterpret_cast<char const *>(
+                detail::contiguous_address(curr()));
+            std::ptrdiff_t const n = (std::min)(
+                std::ptrdiff_t(last_ - curr()) - 1, std::ptrdiff_t(0xff));
+            ascii_ahead_ = uint8_t(simd::ascii_prefix(ptr + 1, n));
+        }
+
         constexpr char32_t decode_code_point()
         {
             if constexpr (FromFormat == format::utf8) {
@@ -3189,10 +3271,14 @@ namespace boost::parser::detail { namespace text {
             ) {
                 curr() = initial;
             }
+            if constexpr (use_ascii_runs)
+                find_ascii_run();
         }
 
         constexpr void read_reverse()
         {
+            if constexpr (use_ascii_runs)
+                ascii_ahead_ = 0;
             auto initial = curr();
             if constexpr (noexcept(ErrorHandler{}(""))) {
                 char32_t cp = decode_code_point_reverse();
@@ -3242,6 +3328,7 @@ namespace boost::parser::detail { namespace text {
         uint8_t buf_index_ = 0;
         uint8_t buf_last_ = 0;
         uint8_t to_increment_ = 0;
+        uint8_t ascii_ahead_ = 0;
 
         [[no_unique_address]] S last_ = {};
 
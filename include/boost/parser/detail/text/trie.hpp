@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <type_traits>
 #include <vector>
 
@@ -893,6 +894,7 @@ namespace boost::parser::detail { namespace text {
                     if (other.children_[i]) {
                         children_[i].reset(
                             new trie_node_t(*other.children_[i]));
+                        children_[i]->parent_ = this;
                     }
                 }
             }
@@ -1144,6 +1146,7 @@ namespace boost::parser::detail { namespace text {
                 for (auto const & node : other.children_) {
                     std::unique_ptr<trie_node_t> new_node(
                         new trie_node_t(*node));
+                    new_node->parent_ = this;
                     children_.push_back(std::move(new_node));
                 }
             }
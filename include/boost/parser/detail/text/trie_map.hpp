@@ -282,6 +282,8 @@ namespace boost::parser::detail { namespace text {
         size_type size() const { return size_; }
         size_type max_size() const { return PTRDIFF_MAX; }
 
+        key_compare key_comp() const { return comp_; }
+
         const_iterator begin() const
         {
             iter_state_t state{&header_, 0};
@@ -701,6 +701,68 @@ namespace boost::parser::detail {
             0x1E917, 0x1E918, 0x1E919, 0x1E91A, 0x1E91B, 0x1E91C, 0x1E91D,
             0x1E91E, 0x1E91F, 0x1E920, 0x1E921};
     };
+
+    /** A two-level bitmap over all code points, made at compile time from
+        char_set<Tag>::chars (which need not be sorted).  stage1_ maps each
+        256-code point block to an index into stage2_, which holds a 256-bit
+        membership bitmap per block.  All the blocks containing no members
+        share the empty bitmap stage2_[0]. */
+    template<typename Tag>
+    struct char_set_table
+    {
+        static constexpr uint32_t block_size = 0x100;
+        static constexpr uint32_t stage1_size = 0x110000 / block_size;
+
+        static constexpr int used_blocks()
+        {
+            bool used[stage1_size] = {};
+            int retval = 0;
+            for (uint32_t c : char_set<Tag>::chars) {
+                if (!used[c / block_size]) {
+                    used[c / block_size] = true;
+                    ++retval;
+                }
+            }
+            return retval;
+        }
+
+        static constexpr int stage2_size = used_blocks() + 1;
+        static_assert(
+            stage2_size <= 0x100,
+            "char_set_table's stage1 indices are 8 bits.");
+
+        struct tables_t
+        {
+            uint8_t stage1_[stage1_size];
+            uint64_t stage2_[stage2_size][block_size / 64];
+        };
+
+        static constexpr tables_t make_tables()
+        {
+            tables_t retval{};
+            int next_block = 1;
+            for (uint32_t c : char_set<Tag>::chars) {
+                uint8_t & block = retval.stage1_[c / block_size];
+                if (!block)
+                    block = uint8_t(next_block++);
+                uint32_t const offset = c % block_size;
+                retval.stage2_[block][offset / 64] |= uint64_t(1)
+                                                      << (offset % 64);
+            }
+            return retval;
+        }
+
+        static constexpr tables_t tables = make_tables();
+
+        static constexpr bool contains(uint32_t cp)
+        {
+            if (0x10ffff < cp)
+                return false;
+            uint8_t const block = tables.stage1_[cp / block_size];
+            uint32_t const offset = cp % block_size;
+            return (tables.stage2_[block][offset / 64] >> (offset % 64)) & 1;
+        }
+    };
 }
 
 #endif
@@ -0,0 +1,308 @@
+#ifndef BOOST_PARSER_INCREMENTAL_PARSE_HPP
+#define BOOST_PARSER_INCREMENTAL_PARSE_HPP
+
+#include <boost/parser/search.hpp>
+
+#include <string>
+#include <string_view>
+
+
+namespace boost::parser {
+
+    /** The possible states of an `incremental_parse`, as reported by its
+        `feed()` and `finish()` members. */
+    enum class incremental_parse_status {
+        need_more_input, /// The pending input may still be matched.
+        done,            /// The pending input begins with a match.
+        error            /// The pending input can never be matched.
+    };
+
+    namespace detail {
+        // Pending input shorter than this is re-parsed on every call to
+        // incremental_parse::feed(); longer pending input is only re-parsed
+        // once it has doubled in size.
+        inline constexpr std::size_t incremental_reparse_threshold = 4096;
+
+        struct incremental_input_end
+        {
+            bool reached(char const * it)
+            {
+                if (it != last_)
+                    return false;
+                hit_ = true;
+                return true;
+            }
+
+            char const * last_ = nullptr;
+            bool hit_ = false;
+            bool final_ = false;
+        };
+
+        // Compares equal to the end of the input buffered so far, and records
+        // that the parser looked there.  A parser that never does cannot
+        // parse differently once more input arrives.
+        struct incremental_sentinel
+        {
+            friend bool operator==(char const * it, incremental_sentinel s)
+            {
+                return s.end_->reached(it);
+            }
+#if !defined(__cpp_impl_three_way_comparison)
+            friend bool operator==(incremental_sentinel s, char const * it)
+            {
+                return s.end_->reached(it);
+            }
+            friend bool operator!=(char const * it, incremental_sentinel s)
+            {
+                return !s.end_->reached(it);
+            }
+            friend bool operator!=(incremental_sentinel s, char const * it)
+            {
+                return !s.end_->reached(it);
+            }
+#endif
+
+            incremental_input_end * end_ = nullptr;
+        };
+
+        // Keeps expectation failures that happen at the end of the buffered
+        // input away from the user's error handler; they only mean that the
+        // rest of the message has not arrived yet.  Everything else is
+        // forwarded, with the end of the buffered input as the sentinel.
+        template<typename ErrorHandler>
+        struct incremental_error_handler
+        {
+            template<typename Iter, typename Sentinel>
+            error_handler_result operator()(
+                Iter first, Sentinel last, parse_error<Iter> const & e) const
+            {
+                if (last.end_->hit_ && !last.end_->final_)
+                    return error_handler_result::fail;
+                return handler_(first, last.end_->last_, e);
+            }
+
+            template<typename Context, typename Iter>
+            void diagnose(
+                diagnostic_kind kind,
+                std::string_view message,
+                Context const & context,
+                Iter it) const
+            {
+                auto & end = *parser::_end(context).end_;
+                bool const hit = end.hit_;
+                handler_.diagnose(kind, message, context, it);
+                end.hit_ = hit;
+            }
+
+            template<typename Context>
+            void diagnose(
+                diagnostic_kind kind,
+                std::string_view message,
+                Context const & context) const
+            {
+                auto & end = *parser::_end(context).end_;
+                bool const hit = end.hit_;
+                handler_.diagnose(kind, message, context);
+                end.hit_ = hit;
+            }
+
+            ErrorHandler handler_;
+        };
+
+        template<typename Parser, typename SkipParser>
+        auto incremental_prefix_parse(
+            char const *& first,
+            incremental_sentinel last,
+            Parser const & parser,
+            SkipParser const & skip)
+        {
+            if constexpr (std::is_same_v<
+                              SkipParser,
+                              parser_interface<eps_parser<phony>>>) {
+                return parser::prefix_parse(first, last, parser);
+            } else {
+                return parser::prefix_parse(first, last, parser, skip);
+            }
+        }
+    }
+
+    /** A push-style parse of input that arrives in pieces, such as the
+        chunks read from a socket or pipe.  Each call to `feed()` appends a
+        chunk to the pending input, and parses the pending input from the
+        start.  The result is `incremental_parse_status::done` if the pending
+        input begins with a match that no further input could change,
+        `incremental_parse_status::need_more_input` if the parser reached the
+        end of the pending input, and `incremental_parse_status::error`
+        otherwise.  After `done`, `result()` holds the result of the parse,
+        and the matched input is removed from the pending input; call `feed()`
+        again, with an empty chunk if there is no new input, to parse the next
+        match.  Call `finish()` once the input is exhausted, to parse the
+        pending input as-is.
+
+        Expectation failures at the end of the pending input are not reported
+        to `parser`'s error handler, unless they happen within `finish()`.
+        With a skipper, the skipper looks past the end of each match for more
+        input to skip, so the last complete match in the pending input is not
+        reported `done` until more non-skippable input, or a call to
+        `finish()`, arrives.
+
+        Since each parse starts over at the beginning of the pending input,
+        once a partial match is longer than a few KiB, `feed()` does not
+        parse again until the pending input has at least doubled in size;
+        this keeps the total work within a constant factor of a single parse
+        of the whole match.  A long match, or an error in one, may therefore
+        only be reported by a later `feed()` than the one that completes it,
+        or by `finish()`.  Any iterators to the pending input within
+        `result()` are invalidated by the next call to `feed()`, `finish()`,
+        or `reset()`. */
+    template<
+        typename Parser,
+        typename GlobalState,
+        typename ErrorHandler,
+        typename SkipParser = parser_interface<eps_parser<detail::phony>>>
+    struct incremental_parse
+    {
+    private:
+        using parser_type = parser_interface<
+            Parser,
+            GlobalState,
+            detail::incremental_error_handler<ErrorHandler>>;
+
+    public:
+        /** The type returned by `prefix_parse()` for `parser`; either
+            `bool`, or a `std::optional` of `parser`'s attribute type. */
+        using result_type = decltype(detail::incremental_prefix_parse(
+            std::declval<char const *&>(),
+            detail::incremental_sentinel{},
+            std::declval<parser_type const &>(),
+            std::declval<SkipParser const &>()));
+
+        incremental_parse(
+            parser_interface<Parser, GlobalState, ErrorHandler> const &
+                parser) :
+            parser_(parser.parser_, parser.globals_, {parser.error_handler_})
+        {}
+        incremental_parse(
+            parser_interface<Parser, GlobalState, ErrorHandler> const & parser,
+            SkipParser const & skip) :
+            parser_(parser.parser_, parser.globals_, {parser.error_handler_}),
+            skip_(skip)
+        {}
+
+        /** Appends `chunk` to the pending input, and parses the pending
+            input.
+
+            \pre `finish()` has not been called since construction or the
+            last call to `reset()`. */
+        incremental_parse_status feed(std::string_view chunk)
+        {
+            BOOST_PARSER_ASSERT(!end_.final_);
+            if (!chunk.empty()) {
+                buffer_.erase(0, start_);
+                start_ = 0;
+                buffer_.append(chunk.data(), chunk.size());
+            }
+            return parse_pending();
+        }
+
+        /** Indicates that no more input will be fed, and parses the pending
+            input.  The end of the pending input is treated as the end of the
+            input. */
+        incremental_parse_status finish()
+        {
+            end_.final_ = true;
+            return parse_pending();
+        }
+
+        /** Returns the state reported by the most recent call to `feed()` or
+            `finish()`. */
+        incremental_parse_status status() const { return status_; }
+
+        /** Returns the result of the most recent parse.  This is only
+            meaningful when `status() == incremental_parse_status::done`. */
+        result_type const & result() const & { return result_; }
+        result_type && result() && { return std::move(result_); }
+
+        /** Returns the input that has been fed, but not yet matched. */
+        std::string_view pending() const
+        {
+            return std::string_view(buffer_).substr(start_);
+        }
+
+        /** Discards all pending input and results, so that the next call to
+            `feed()` starts a fresh parse. */
+        void reset()
+        {
+            buffer_.clear();
+            start_ = 0;
+            result_ = result_type();
+            status_ = incremental_parse_status::need_more_input;
+            end_ = detail::incremental_input_end{};
+            next_parse_size_ = 0;
+        }
+
+    private:
+        incremental_parse_status parse_pending()
+        {
+            if (status_ == incremental_parse_status::error)
+                return status_;
+            if (status_ == incremental_parse_status::need_more_input &&
+                !end_.final_ && pending().size() < next_parse_size_) {
+                return status_;
+            }
+
+            char const * const first = buffer_.data() + start_;
+            char const * it = first;
+            end_.last_ = buffer_.data() + buffer_.size();
+            end_.hit_ = false;
+            result_ = detail::incremental_prefix_parse(
+                it, detail::incremental_sentinel{&end_}, parser_, skip_);
+
+            if (end_.hit_ && !end_.final_) {
+                result_ = result_type();
+                status_ = incremental_parse_status::need_more_input;
+                std::size_t const size = pending().size();
+                next_parse_size_ =
+                    size < detail::incremental_reparse_threshold ? 0
+                                                                 : 2 * size;
+            } else if (result_) {
+                start_ += it - first;
+                status_ = incremental_parse_status::done;
+            } else {
+                status_ = incremental_parse_status::error;
+            }
+            return status_;
+        }
+
+        parser_type parser_;
+        SkipParser skip_;
+        std::string buffer_;
+        std::size_t start_ = 0;
+        result_type result_ = result_type();
+        incremental_parse_status status_ =
+            incremental_parse_status::need_more_input;
+        detail::incremental_input_end end_;
+        std::size_t next_parse_size_ = 0;
+    };
+
+    template<typename Parser, typename GlobalState, typename ErrorHandler>
+    incremental_parse(parser_interface<Parser, GlobalState, ErrorHandler>)
+        -> incremental_parse<Parser, GlobalState, ErrorHandler>;
+
+    template<
+        typename Parser,
+        typename GlobalState,
+        typename ErrorHandler,
+        typename SkipParser>
+    incremental_parse(
+        parser_interface<Parser, GlobalState, ErrorHandler>,
+        parser_interface<SkipParser>)
+        -> incremental_parse<
+            Parser,
+            GlobalState,
+            ErrorHandler,
+            parser_interface<SkipParser>>;
+
+}
+
+#endif
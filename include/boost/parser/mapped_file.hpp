@@ -0,0 +1,178 @@
+#ifndef BOOST_PARSER_MAPPED_FILE_HPP
+#define BOOST_PARSER_MAPPED_FILE_HPP
+
+#include <boost/parser/config.hpp>
+
+#ifndef BOOST_PARSER_MAPPED_FILE_USE_MMAP
+#if defined(__has_include)
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+#define BOOST_PARSER_MAPPED_FILE_USE_MMAP 1
+#endif
+#endif
+#endif
+#ifndef BOOST_PARSER_MAPPED_FILE_USE_MMAP
+#define BOOST_PARSER_MAPPED_FILE_USE_MMAP 0
+#endif
+
+#if BOOST_PARSER_MAPPED_FILE_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <cstdio>
+#include <memory>
+#endif
+
+#include <cerrno>
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <utility>
+
+
+namespace boost::parser {
+
+    /** A read-only view of the contents of a file, as a contiguous range of
+        `char`.  Where POSIX `mmap()` is available, the file is mapped into
+        memory rather than read, so that parsing can start before the whole
+        file has been paged in, and the file's contents are not copied into
+        memory the process owns; the mapping is advised to expect sequential
+        access.  Elsewhere, the file is read into a buffer.
+
+        Since `begin()` and `end()` are `char const *`s, a `mapped_file` can
+        be used anywhere a `std::string` can: with `parse()`,
+        `prefix_parse()`, `search_all()`, `split()`, `replace()`, etc.  The
+        file must not be truncated while it is mapped. */
+    struct mapped_file
+    {
+        mapped_file() = default;
+
+        /** Opens and maps the file at `path`.  Throws `std::system_error` if
+            the file cannot be opened, or cannot be mapped. */
+        explicit mapped_file(char const * path) { open(path); }
+        /** Opens and maps the file at `path`.  Throws `std::system_error` if
+            the file cannot be opened, or cannot be mapped. */
+        explicit mapped_file(std::string const & path) { open(path.c_str()); }
+
+        mapped_file(mapped_file && other) noexcept :
+            data_(std::exchange(other.data_, nullptr)),
+            size_(std::exchange(other.size_, 0))
+#if !BOOST_PARSER_MAPPED_FILE_USE_MMAP
+            ,
+            buffer_(std::move(other.buffer_))
+#endif
+        {}
+        mapped_file & operator=(mapped_file && other) noexcept
+        {
+            mapped_file temp(std::move(other));
+            swap(temp);
+            return *this;
+        }
+        ~mapped_file() { close(); }
+
+        char const * begin() const noexcept { return data_; }
+        char const * end() const noexcept { return data_ + size_; }
+
+        char const * data() const noexcept { return data_; }
+        std::size_t size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+
+        /** Unmaps the file, if one is mapped.  `*this` is empty afterward. */
+        void close() noexcept
+        {
+#if BOOST_PARSER_MAPPED_FILE_USE_MMAP
+            if (size_)
+                ::munmap(const_cast<char *>(data_), size_);
+#else
+            buffer_.reset();
+#endif
+            data_ = nullptr;
+            size_ = 0;
+        }
+
+        void swap(mapped_file & other) noexcept
+        {
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+#if !BOOST_PARSER_MAPPED_FILE_USE_MMAP
+            std::swap(buffer_, other.buffer_);
+#endif
+        }
+
+    private:
+        [[noreturn]] static void throw_error(int error, char const * path)
+        {
+            throw std::system_error(error, std::generic_category(), path);
+        }
+
+#if BOOST_PARSER_MAPPED_FILE_USE_MMAP
+        void open(char const * path)
+        {
+            int const fd = ::open(path, O_RDONLY);
+            if (fd < 0)
+                throw_error(errno, path);
+            struct ::stat st;
+            if (::fstat(fd, &st) < 0) {
+                int const error = errno;
+                ::close(fd);
+                throw_error(error, path);
+            }
+            // Empty files cannot be mapped, and need not be.
+            if (0 < st.st_size) {
+                std::size_t const size = st.st_size;
+                void * const p =
+                    ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (p == MAP_FAILED) {
+                    int const error = errno;
+                    ::close(fd);
+                    throw_error(error, path);
+                }
+#if defined(MADV_SEQUENTIAL)
+                ::madvise(p, size, MADV_SEQUENTIAL);
+#endif
+                data_ = static_cast<char const *>(p);
+                size_ = size;
+            }
+            // The mapping stays valid after the file is closed.
+            ::close(fd);
+        }
+#else
+        void open(char const * path)
+        {
+            std::FILE * const f = std::fopen(path, "rb");
+            if (!f)
+                throw_error(errno, path);
+            long size = -1;
+            if (!std::fseek(f, 0, SEEK_END))
+                size = std::ftell(f);
+            if (size < 0 || std::fseek(f, 0, SEEK_SET)) {
+                int const error = errno;
+                std::fclose(f);
+                throw_error(error, path);
+            }
+            if (0 < size) {
+                auto buffer = std::make_unique<char[]>(size);
+                std::size_t const n = std::fread(buffer.get(), 1, size, f);
+                if (n != std::size_t(size)) {
+                    std::fclose(f);
+                    throw_error(EIO, path);
+                }
+                buffer_ = std::move(buffer);
+                data_ = buffer_.get();
+                size_ = n;
+            }
+            std::fclose(f);
+        }
+#endif
+
+        char const * data_ = nullptr;
+        std::size_t size_ = 0;
+#if !BOOST_PARSER_MAPPED_FILE_USE_MMAP
+        std::unique_ptr<char[]> buffer_;
+#endif
+    };
+
+}
+
+#endif
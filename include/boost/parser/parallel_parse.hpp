@@ -0,0 +1,713 @@
+#ifndef BOOST_PARSER_PARALLEL_PARSE_HPP
+#define BOOST_PARSER_PARALLEL_PARSE_HPP
+
+#include <boost/parser/split.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+
+namespace boost::parser {
+
+    namespace detail {
+        inline int parallel_thread_count(int n_threads)
+        {
+            if (0 < n_threads)
+                return n_threads;
+            return (std::max)(1, int(std::thread::hardware_concurrency()));
+        }
+
+        // Calls f(i) for each i in [0, n), on up to n_threads threads,
+        // including the calling thread.  Indices are handed out in batches
+        // from a shared counter, so that a thread that finishes early takes
+        // on more of the remaining work.  The first exception thrown by f is
+        // rethrown once all the threads have stopped.
+        template<typename F>
+        void parallel_for(std::size_t n, int n_threads, F const & f)
+        {
+            n_threads = detail::parallel_thread_count(n_threads);
+            if (n < std::size_t(n_threads))
+                n_threads = int(n);
+            if (n_threads <= 1) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    f(i);
+                }
+                return;
+            }
+
+            std::size_t const batch =
+                (std::max)(std::size_t(1), n / (std::size_t(n_threads) * 8));
+            std::atomic<std::size_t> next = 0;
+            std::atomic<bool> failed = false;
+            std::exception_ptr exception;
+            std::mutex exception_mutex;
+            auto work = [&] {
+                try {
+                    while (!failed.load(std::memory_order_relaxed)) {
+                        std::size_t const first = next.fetch_add(batch);
+                        if (n <= first)
+                            break;
+                        std::size_t const last = (std::min)(n, first + batch);
+                        for (std::size_t i = first; i < last; ++i) {
+                            f(i);
+                        }
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(exception_mutex);
+                    if (!exception)
+                        exception = std::current_exception();
+                    failed = true;
+                }
+            };
+
+            std::vector<std::thread> threads;
+            threads.reserve(n_threads - 1);
+            try {
+                for (int i = 1; i < n_threads; ++i) {
+                    threads.emplace_back(work);
+                }
+            } catch (std::system_error const &) {
+                // Make do with the threads we were able to start.
+            }
+            work();
+            for (auto & thread : threads) {
+                thread.join();
+            }
+            if (exception)
+                std::rethrow_exception(exception);
+        }
+
+        // The char matched by a delimiter parser that matches only a single
+        // ASCII char, such as lit('\n'), or -1 for any other parser.
+        template<typename Parser>
+        constexpr int single_char_delimiter(Parser const &)
+        {
+            return -1;
+        }
+        template<typename Expected, typename AttributeType>
+        constexpr int single_char_delimiter(
+            char_parser<Expected, AttributeType> const & parser)
+        {
+            if constexpr (std::is_integral_v<Expected>) {
+                if (uint32_t(parser.expected_) < 0x80)
+                    return int(parser.expected_);
+            }
+            return -1;
+        }
+        template<typename Parser>
+        constexpr int single_char_delimiter(omit_parser<Parser> const & parser)
+        {
+            return detail::single_char_delimiter(parser.parser_);
+        }
+
+        template<
+            typename R,
+            typename DelimiterParser,
+            typename DelimiterGlobalState,
+            typename DelimiterErrorHandler>
+        auto split_records(
+            R const & r,
+            parser_interface<
+                DelimiterParser,
+                DelimiterGlobalState,
+                DelimiterErrorHandler> const & delimiter_parser)
+        {
+            auto const records_view = parser::split(r, delimiter_parser);
+            using record_type =
+                remove_cv_ref_t<decltype(*records_view.begin())>;
+            std::vector<record_type> records;
+
+            // Single-char delimiters in contiguous chars are found with
+            // memchr(), rather than with one search() per record.
+            auto const base = records_view.base();
+            using iter_t = decltype(base.begin());
+            int const delimiter =
+                detail::single_char_delimiter(delimiter_parser.parser_);
+            if constexpr (
+                std::is_same_v<iter_t, decltype(base.end())> &&
+                is_contiguous_char_iter_v<iter_t> &&
+                std::is_same_v<record_type, BOOST_PARSER_SUBRANGE<iter_t>>) {
+                if (0 <= delimiter) {
+                    auto first = base.begin();
+                    auto const last = base.end();
+                    if (first == last)
+                        return records;
+                    for (;;) {
+                        auto const ptr = reinterpret_cast<char const *>(
+                            std::addressof(*first));
+                        void const * const match =
+                            std::memchr(ptr, delimiter, last - first);
+                        if (!match) {
+                            records.push_back(record_type(first, last));
+                            break;
+                        }
+                        auto const record_last =
+                            first + (static_cast<char const *>(match) - ptr);
+                        records.push_back(record_type(first, record_last));
+                        first = std::next(record_last);
+                        if (first == last) {
+                            records.push_back(record_type(last, last));
+                            break;
+                        }
+                    }
+                    return records;
+                }
+            }
+
+            for (auto record : records_view) {
+                records.push_back(record);
+            }
+            return records;
+        }
+
+        template<
+            typename R,
+            typename DelimiterParser,
+            typename DelimiterGlobalState,
+            typename DelimiterErrorHandler,
+            typename Parser,
+            typename GlobalState,
+            typename ErrorHandler,
+            typename SkipParser>
+        auto parallel_parse_records_impl(
+            R const & r,
+            parser_interface<
+                DelimiterParser,
+                DelimiterGlobalState,
+                DelimiterErrorHandler> const & delimiter_parser,
+            parser_interface<Parser, GlobalState, ErrorHandler> const &
+                record_parser,
+            parser_interface<SkipParser> const & skip,
+            int n_threads)
+        {
+            auto const records =
+                detail::split_records(r, delimiter_parser);
+            using record_type = typename decltype(records)::value_type;
+
+            auto parse_record = [&](record_type const & record) {
+                if constexpr (std::is_same_v<SkipParser, eps_parser<phony>>)
+                    return parser::parse(record, record_parser);
+                else
+                    return parser::parse(record, record_parser, skip);
+            };
+            using result_type = decltype(parse_record(records.front()));
+
+            if constexpr (std::is_same_v<result_type, bool>) {
+                // std::vector<bool> elements cannot be written concurrently.
+                std::vector<char> results(records.size());
+                detail::parallel_for(
+                    records.size(), n_threads, [&](std::size_t i) {
+                        results[i] = parse_record(records[i]);
+                    });
+                return std::vector<bool>(results.begin(), results.end());
+            } else {
+                std::vector<result_type> results(records.size());
+                detail::parallel_for(
+                    records.size(), n_threads, [&](std::size_t i) {
+                        results[i] = parse_record(records[i]);
+                    });
+                return results;
+            }
+        }
+
+        // Used for speculative parses, whose failures are expected, and must
+        // not be reported.
+        struct silent_error_handler
+        {
+            template<typename Iter, typename Sentinel>
+            error_handler_result
+            operator()(Iter, Sentinel, parse_error<Iter> const &) const
+            {
+                return error_handler_result::fail;
+            }
+
+            template<typename Context, typename Iter>
+            void diagnose(
+                diagnostic_kind, std::string_view, Context const &, Iter) const
+            {}
+
+            template<typename Context>
+            void
+            diagnose(diagnostic_kind, std::string_view, Context const &) const
+            {}
+        };
+
+        template<typename Parser, typename GlobalState, typename ErrorHandler>
+        auto silenced(
+            parser_interface<Parser, GlobalState, ErrorHandler> const & parser)
+        {
+            return parser_interface<Parser, GlobalState, silent_error_handler>{
+                parser.parser_, parser.globals_, silent_error_handler{}};
+        }
+
+        // Smaller chunks cost more in guessing and stitching than they save.
+        inline constexpr std::size_t parallel_list_chunk_size = 16 * 1024;
+
+        template<typename I, typename Elements>
+        struct list_chunk
+        {
+            Elements elements;
+            I first;            // The separator before the first element.
+            I last;             // Just after the last element.
+            bool found = false; // Whether a plausible start was found.
+            bool ended = false; // Whether the list ended at last.
+        };
+
+        // Parses `r` as `element_parser % separator_parser` would, by dividing
+        // it into chunks that are parsed concurrently.  Each chunk but the
+        // first guesses where its first element starts: just after the first
+        // separator match at or after the chunk's nominal start offset that
+        // is followed by list elements up to the next chunk, or to the end
+        // of the input.  A separator match inside an element (say, a comma
+        // inside a quoted string) almost always fails that check quickly,
+        // and the next match is tried.  The chunks are then stitched
+        // together in order; the parse of each chunk ends at the first
+        // element boundary at or after the next chunk's nominal start, and
+        // if that is not where the next chunk's guess starts, the guess was
+        // wrong, and the next chunk is reparsed sequentially instead.
+        template<
+            typename R,
+            typename Parser,
+            typename GlobalState,
+            typename ErrorHandler,
+            typename SeparatorParser,
+            typename SeparatorGlobalState,
+            typename SeparatorErrorHandler,
+            typename SkipParser>
+        auto parallel_parse_list_impl(
+            R const & r,
+            parser_interface<Parser, GlobalState, ErrorHandler> const &
+                element_parser,
+            parser_interface<
+                SeparatorParser,
+                SeparatorGlobalState,
+                SeparatorErrorHandler> const & separator_parser,
+            parser_interface<SkipParser> const & skip,
+            int n_threads,
+            std::size_t chunks)
+        {
+            auto const r_ = detail::make_input_subrange(r);
+            using iter_t = decltype(r_.begin());
+            static_assert(
+                std::is_base_of_v<
+                    std::random_access_iterator_tag,
+                    typename std::iterator_traits<
+                        iter_t>::iterator_category>,
+                "parallel_parse_list() requires input that can be divided "
+                "into chunks in constant time, such as a range of char.");
+            iter_t const first = r_.begin();
+            iter_t last = first;
+            if constexpr (std::is_same_v<iter_t, decltype(r_.end())>) {
+                last = r_.end();
+            } else {
+                while (last != r_.end()) {
+                    ++last;
+                }
+            }
+
+            auto const element = detail::silenced(element_parser);
+            // Each element after the first is parsed with its separator, in
+            // one call.
+            parser_interface<Parser> const plain_element{
+                element_parser.parser_};
+            parser_interface<SeparatorParser> const plain_separator{
+                separator_parser.parser_};
+            auto const next = omit[plain_separator] >> plain_element;
+            auto const next_element = parser_interface<
+                remove_cv_ref_t<decltype(next.parser_)>,
+                GlobalState,
+                silent_error_handler>{
+                next.parser_, element_parser.globals_, silent_error_handler{}};
+            constexpr bool no_skip =
+                std::is_same_v<SkipParser, eps_parser<phony>>;
+            auto parse_one = [&](iter_t & it, auto const & parser) {
+                if constexpr (no_skip)
+                    return parser::prefix_parse(it, last, parser);
+                else
+                    return parser::prefix_parse(it, last, parser, skip);
+            };
+
+            iter_t probe = first;
+            using element_result = decltype(parse_one(probe, element));
+            constexpr bool has_attribute =
+                !std::is_same_v<element_result, bool>;
+            using attr_type = typename std::conditional_t<
+                has_attribute,
+                element_result,
+                std::optional<char>>::value_type;
+            using chunk_type = list_chunk<iter_t, std::vector<attr_type>>;
+
+            auto append = [](chunk_type & chunk, auto && element) {
+                if constexpr (has_attribute)
+                    chunk.elements.push_back(std::move(*element));
+            };
+            // Parses separator-element pairs, starting just after an
+            // element, until reaching an element boundary at or after stop,
+            // or the end of the list.
+            auto extend = [&](chunk_type & chunk, iter_t stop) {
+                while (chunk.last < stop) {
+                    iter_t it = chunk.last;
+                    auto e = parse_one(it, next_element);
+                    if (!e || it == chunk.last) {
+                        chunk.ended = true;
+                        return;
+                    }
+                    append(chunk, e);
+                    chunk.last = it;
+                }
+            };
+
+            // The nominal starts of the chunks, followed by last.
+            std::size_t const size = last - first;
+            if (!chunks) {
+                std::size_t const threads =
+                    detail::parallel_thread_count(n_threads);
+                chunks = threads == 1 ? 1 : threads * 4;
+                chunks = (std::min)(chunks, size / parallel_list_chunk_size);
+            }
+            chunks = (std::max)(std::size_t(1), (std::min)(chunks, size / 2));
+            std::vector<iter_t> offsets;
+            for (std::size_t i = 0; i < chunks; ++i) {
+                offsets.push_back(first + size / chunks * i);
+            }
+            offsets.push_back(last);
+
+            int const delimiter =
+                detail::single_char_delimiter(separator_parser.parser_);
+            auto find_separator = [&](iter_t it) {
+                if constexpr (is_contiguous_char_iter_v<iter_t>) {
+                    if (0 <= delimiter) {
+                        if (it == last)
+                            return last;
+                        auto const ptr = reinterpret_cast<char const *>(
+                            std::addressof(*it));
+                        void const * const match =
+                            std::memchr(ptr, delimiter, last - it);
+                        if (!match)
+                            return last;
+                        return it + (static_cast<char const *>(match) - ptr);
+                    }
+                }
+                return parser::search(
+                           BOOST_PARSER_SUBRANGE(it, last), separator_parser)
+                    .begin();
+            };
+
+            // Each wrong guess costs a reparse, so a chunk that cannot find
+            // a plausible start quickly is left for the stitching pass.
+            int const max_guesses = 8;
+            std::vector<chunk_type> parsed(chunks);
+            auto parse_chunk = [&](std::size_t i) {
+                chunk_type & chunk = parsed[i];
+                iter_t const stop = offsets[i + 1];
+                if (i == 0) {
+                    iter_t it = first;
+                    auto e = parse_one(it, element);
+                    if (!e)
+                        return;
+                    chunk.found = true;
+                    append(chunk, e);
+                    chunk.first = chunk.last = it;
+                    extend(chunk, stop);
+                    return;
+                }
+                iter_t guess = offsets[i];
+                for (int j = 0; j < max_guesses && guess != last; ++j) {
+                    iter_t const separator_first = find_separator(guess);
+                    if (stop <= separator_first)
+                        return;
+                    guess = std::next(separator_first);
+                    iter_t it = separator_first;
+                    auto e = parse_one(it, next_element);
+                    if (!e)
+                        continue;
+                    chunk = chunk_type{};
+                    append(chunk, e);
+                    chunk.first = separator_first;
+                    chunk.last = it;
+                    extend(chunk, stop);
+                    if (!chunk.ended || chunk.last == last) {
+                        chunk.found = true;
+                        return;
+                    }
+                }
+                chunk.elements.clear();
+            };
+            if (1 < chunks)
+                detail::parallel_for(chunks, n_threads, parse_chunk);
+
+            chunk_type & result = parsed[0];
+            bool success = result.found;
+            if (success) {
+                for (std::size_t i = 1; i < chunks && !result.ended; ++i) {
+                    chunk_type & chunk = parsed[i];
+                    if (chunk.found && chunk.first == result.last) {
+                        result.elements.insert(
+                            result.elements.end(),
+                            std::make_move_iterator(chunk.elements.begin()),
+                            std::make_move_iterator(chunk.elements.end()));
+                        result.last = chunk.last;
+                        result.ended = chunk.ended;
+                    } else {
+                        extend(result, offsets[i + 1]);
+                    }
+                }
+                success = result.last == last;
+            }
+
+            // With a single chunk, or on failure, parse sequentially; that
+            // way, failures are reported through element_parser's error
+            // handler, just as they would be by parse().
+            auto const list = plain_element % plain_separator;
+            auto const sequential =
+                parser_interface<
+                    remove_cv_ref_t<decltype(list.parser_)>,
+                    GlobalState,
+                    ErrorHandler>{
+                    list.parser_,
+                    element_parser.globals_,
+                    element_parser.error_handler_};
+            std::vector<attr_type> & elements = result.elements;
+            if (!success) {
+                elements.clear();
+                if constexpr (!has_attribute && no_skip)
+                    success = parser::parse(r, sequential);
+                else if constexpr (!has_attribute)
+                    success = parser::parse(r, sequential, skip);
+                else if constexpr (no_skip)
+                    success = parser::parse(r, sequential, elements);
+                else
+                    success = parser::parse(r, sequential, skip, elements);
+            }
+
+            if constexpr (has_attribute) {
+                std::optional<std::vector<attr_type>> retval;
+                if (success)
+                    retval = std::move(elements);
+                return retval;
+            } else {
+                return success;
+            }
+        }
+    }
+
+    /** Splits `r` into records, using the same semantics as `split(r,
+        delimiter_parser)`, and parses each record using `record_parser`, on
+        up to `n_threads` threads (or `std::thread::hardware_concurrency()`
+        threads, if `n_threads <= 0`).  Returns a `std::vector` containing,
+        for each record in input order, the result of `parse(record,
+        record_parser)`.
+
+        The records are found sequentially; only the record parses are
+        divided among the threads.  Each record parse has its own parse
+        context, but `record_parser`'s globals and error handler are shared
+        by all threads, and so must be safe to use concurrently.  For the
+        same reason, `record_parser` must not use symbol table operations
+        that take effect in subsequent parses, such as
+        `symbols::insert_for_next_parse()`. */
+#if BOOST_PARSER_USE_CONCEPTS
+    template<
+        parsable_range R,
+        typename DelimiterParser,
+        typename DelimiterGlobalState,
+        typename DelimiterErrorHandler,
+        typename Parser,
+        typename GlobalState,
+        typename ErrorHandler>
+#else
+    template<
+        typename R,
+        typename DelimiterParser,
+        typename DelimiterGlobalState,
+        typename DelimiterErrorHandler,
+        typename Parser,
+        typename GlobalState,
+        typename ErrorHandler,
+        typename Enable = std::enable_if_t<detail::is_parsable_range_v<R>>>
+#endif
+    auto parallel_parse_records(
+        R const & r,
+        parser_interface<
+            DelimiterParser,
+            DelimiterGlobalState,
+            DelimiterErrorHandler> const & delimiter_parser,
+        parser_interface<Parser, GlobalState, ErrorHandler> const &
+            record_parser,
+        int n_threads = 0)
+    {
+        return detail::parallel_parse_records_impl(
+            r,
+            delimiter_parser,
+            record_parser,
+            parser_interface<eps_parser<detail::phony>>{},
+            n_threads);
+    }
+
+    /** Splits `r` into records, using the same semantics as `split(r,
+        delimiter_parser)`, and parses each record using `record_parser` and
+        `skip`, on up to `n_threads` threads (or
+        `std::thread::hardware_concurrency()` threads, if `n_threads <= 0`).
+        Returns a `std::vector` containing, for each record in input order,
+        the result of `parse(record, record_parser, skip)`.
+
+        The records are found sequentially; only the record parses are
+        divided among the threads.  Each record parse has its own parse
+        context, but `record_parser`'s globals and error handler are shared
+        by all threads, and so must be safe to use concurrently.  For the
+        same reason, `record_parser` must not use symbol table operations
+        that take effect in subsequent parses, such as
+        `symbols::insert_for_next_parse()`. */
+#if BOOST_PARSER_USE_CONCEPTS
+    template<
+        parsable_range R,
+        typename DelimiterParser,
+        typename DelimiterGlobalState,
+        typename DelimiterErrorHandler,
+        typename Parser,
+        typename GlobalState,
+        typename ErrorHandler,
+        typename SkipParser>
+#else
+    template<
+        typename R,
+        typename DelimiterParser,
+        typename DelimiterGlobalState,
+        typename DelimiterErrorHandler,
+        typename Parser,
+        typename GlobalState,
+        typename ErrorHandler,
+        typename SkipParser,
+        typename Enable = std::enable_if_t<detail::is_parsable_range_v<R>>>
+#endif
+    auto parallel_parse_records(
+        R const & r,
+        parser_interface<
+            DelimiterParser,
+            DelimiterGlobalState,
+            DelimiterErrorHandler> const & delimiter_parser,
+        parser_interface<Parser, GlobalState, ErrorHandler> const &
+            record_parser,
+        parser_interface<SkipParser> const & skip,
+        int n_threads = 0)
+    {
+        return detail::parallel_parse_records_impl(
+            r, delimiter_parser, record_parser, skip, n_threads);
+    }
+
+
+    /** Parses `r` as `parse(r, element_parser % separator_parser)` does, on
+        up to `n_threads` threads (or `std::thread::hardware_concurrency()`
+        threads, if `n_threads <= 0`).  Returns a `std::optional` containing
+        a `std::vector` of the elements' attributes on success, and
+        `std::nullopt` on failure; if `element_parser` has no attribute,
+        returns a `bool` instead.
+
+        `r` is divided into chunks, each parsed on its own thread from a
+        guessed element boundary: the first match of `separator_parser`
+        after the start of the chunk that is followed by list elements.
+        Wrong guesses are found when the chunks are joined, and the parse
+        of any chunk that started at a wrong guess is redone sequentially,
+        so the result is always the same as the sequential parse's.
+        Separator matches inside elements only cost time.  The parses of
+        the elements may be repeated, or made at positions the sequential
+        parse never reaches, so `element_parser` should be free of side
+        effects; as with `parallel_parse_records()`, its globals are shared
+        by all threads.  Errors are reported through `element_parser`'s
+        error handler by a sequential reparse, only if the parse fails.
+        `r` must have random access iterators, such as those of a range of
+        `char`. */
+#if BOOST_PARSER_USE_CONCEPTS
+    template<
+        parsable_range R,
+        typename Parser,
+        typename GlobalState,
+        typename ErrorHandler,
+        typename SeparatorParser,
+        typename SeparatorGlobalState,
+        typename SeparatorErrorHandler>
+#else
+    template<
+        typename R,
+        typename Parser,
+        typename GlobalState,
+        typename ErrorHandler,
+        typename SeparatorParser,
+        typename SeparatorGlobalState,
+        typename SeparatorErrorHandler,
+        typename Enable = std::enable_if_t<detail::is_parsable_range_v<R>>>
+#endif
+    auto parallel_parse_list(
+        R const & r,
+        parser_interface<Parser, GlobalState, ErrorHandler> const &
+            element_parser,
+        parser_interface<
+            SeparatorParser,
+            SeparatorGlobalState,
+            SeparatorErrorHandler> const & separator_parser,
+        int n_threads = 0)
+    {
+        return detail::parallel_parse_list_impl(
+            r,
+            element_parser,
+            separator_parser,
+            parser_interface<eps_parser<detail::phony>>{},
+            n_threads,
+            0);
+    }
+
+    /** Parses `r` as `parse(r, element_parser % separator_parser, skip)`
+        does, on up to `n_threads` threads (or
+        `std::thread::hardware_concurrency()` threads, if `n_threads <= 0`).
+        Returns a `std::optional` containing a `std::vector` of the elements'
+        attributes on success, and `std::nullopt` on failure; if
+        `element_parser` has no attribute, returns a `bool` instead.
+
+        See the overload without `skip` for how the work is divided, and
+        the requirements that places on `element_parser`. */
+#if BOOST_PARSER_USE_CONCEPTS
+    template<
+        parsable_range R,
+        typename Parser,
+        typename GlobalState,
+        typename ErrorHandler,
+        typename SeparatorParser,
+        typename SeparatorGlobalState,
+        typename SeparatorErrorHandler,
+        typename SkipParser>
+#else
+    template<
+        typename R,
+        typename Parser,
+        typename GlobalState,
+        typename ErrorHandler,
+        typename SeparatorParser,
+        typename SeparatorGlobalState,
+        typename SeparatorErrorHandler,
+        typename SkipParser,
+        typename Enable = std::enable_if_t<detail::is_parsable_range_v<R>>>
+#endif
+    auto parallel_parse_list(
+        R const & r,
+        parser_interface<Parser, GlobalState, ErrorHandler> const &
+            element_parser,
+        parser_interface<
+            SeparatorParser,
+            SeparatorGlobalState,
+            SeparatorErrorHandler> const & separator_parser,
+        parser_interface<SkipParser> const & skip,
+        int n_threads = 0)
+    {
+        return detail::parallel_parse_list_impl(
+            r, element_parser, separator_parser, skip, n_threads, 0);
+    }
+
+}
+
+#endif
@@ -16,11 +16,14 @@
 #include <boost/parser/detail/unicode_char_sets.hpp>
 #include <boost/parser/detail/pp_for_each.hpp>
 #include <boost/parser/detail/printing.hpp>
+#include <boost/parser/detail/simd.hpp>
 
 #include <boost/parser/detail/text/algorithm.hpp>
+#include <boost/parser/detail/text/frozen_trie_map.hpp>
 #include <boost/parser/detail/text/trie_map.hpp>
 #include <boost/parser/detail/text/unpack.hpp>
 
+#include <mutex>
 #include <type_traits>
 #include <variant>
 #include <vector>
@@ -459,6 +462,7 @@ namespace boost { namespace parser {
             symbol_table_tries_t * symbol_table_tries_ = nullptr;
             pending_symbol_table_operations_t *
                 pending_symbol_table_operations_ = nullptr;
+            memo_tables_t * memo_tables_ = nullptr;
             ErrorHandler const * error_handler_ = nullptr;
             nope_or_pointer_t<GlobalState> globals_{};
             nope_or_pointer_t<Callbacks, true> callbacks_{};
@@ -498,7 +502,8 @@ namespace boost { namespace parser {
                 GlobalState & globals,
                 symbol_table_tries_t & symbol_table_tries,
                 pending_symbol_table_operations_t &
-                    pending_symbol_table_operations) :
+                    pending_symbol_table_operations,
+                memo_tables_t & memo_tables) :
                 first_(first),
                 last_(last),
                 pass_(std::addressof(success)),
@@ -506,6 +511,7 @@ namespace boost { namespace parser {
                 symbol_table_tries_(std::addressof(symbol_table_tries)),
                 pending_symbol_table_operations_(
                     std::addressof(pending_symbol_table_operations)),
+                memo_tables_(std::addressof(memo_tables)),
                 error_handler_(std::addressof(error_handler)),
                 globals_(nope_or_address(globals))
             {}
@@ -523,7 +529,8 @@ namespace boost { namespace parser {
                 GlobalState & globals,
                 symbol_table_tries_t & symbol_table_tries,
                 pending_symbol_table_operations_t &
-                    pending_symbol_table_operations) :
+                    pending_symbol_table_operations,
+                memo_tables_t & memo_tables) :
                 first_(first),
                 last_(last),
                 pass_(std::addressof(success)),
@@ -531,6 +538,7 @@ namespace boost { namespace parser {
                 symbol_table_tries_(std::addressof(symbol_table_tries)),
                 pending_symbol_table_operations_(
                     std::addressof(pending_symbol_table_operations)),
+                memo_tables_(std::addressof(memo_tables)),
                 error_handler_(std::addressof(error_handler)),
                 globals_(nope_or_address(globals)),
                 callbacks_(std::addressof(callbacks))
@@ -571,6 +579,7 @@ namespace boost { namespace parser {
                 symbol_table_tries_(other.symbol_table_tries_),
                 pending_symbol_table_operations_(
                     other.pending_symbol_table_operations_),
+                memo_tables_(other.memo_tables_),
                 error_handler_(other.error_handler_),
                 globals_(other.globals_),
                 callbacks_(other.callbacks_),
@@ -616,6 +625,7 @@ namespace boost { namespace parser {
                 symbol_table_tries_(other.symbol_table_tries_),
                 pending_symbol_table_operations_(
                     other.pending_symbol_table_operations_),
+                memo_tables_(other.memo_tables_),
                 error_handler_(other.error_handler_),
                 globals_(other.globals_),
                 callbacks_(other.callbacks_),
@@ -749,8 +759,8 @@ namespace boost { namespace parser {
             ErrorHandler const & error_handler,
             nope & n,
             symbol_table_tries_t & symbol_table_tries,
-            pending_symbol_table_operations_t &
-                pending_symbol_table_operations) noexcept
+            pending_symbol_table_operations_t & pending_symbol_table_operations,
+            memo_tables_t & memo_tables) noexcept
         {
             return parse_context(
                 std::bool_constant<DoTrace>{},
@@ -762,7 +772,8 @@ namespace boost { namespace parser {
                 error_handler,
                 n,
                 symbol_table_tries,
-                pending_symbol_table_operations);
+                pending_symbol_table_operations,
+                memo_tables);
         }
 
         template<
@@ -780,8 +791,8 @@ namespace boost { namespace parser {
             ErrorHandler const & error_handler,
             GlobalState & globals,
             symbol_table_tries_t & symbol_table_tries,
-            pending_symbol_table_operations_t &
-                pending_symbol_table_operations) noexcept
+            pending_symbol_table_operations_t & pending_symbol_table_operations,
+            memo_tables_t & memo_tables) noexcept
         {
             return parse_context(
                 std::bool_constant<DoTrace>{},
@@ -793,7 +804,8 @@ namespace boost { namespace parser {
                 error_handler,
                 globals,
                 symbol_table_tries,
-                pending_symbol_table_operations);
+                pending_symbol_table_operations,
+                memo_tables);
         }
 
         template<
@@ -812,8 +824,8 @@ namespace boost { namespace parser {
             Callbacks const & callbacks,
             nope & n,
             symbol_table_tries_t & symbol_table_tries,
-            pending_symbol_table_operations_t &
-                pending_symbol_table_operations) noexcept
+            pending_symbol_table_operations_t & pending_symbol_table_operations,
+            memo_tables_t & memo_tables) noexcept
         {
             return parse_context(
                 std::bool_constant<DoTrace>{},
@@ -826,7 +838,8 @@ namespace boost { namespace parser {
                 callbacks,
                 n,
                 symbol_table_tries,
-                pending_symbol_table_operations);
+                pending_symbol_table_operations,
+                memo_tables);
         }
 
         template<
@@ -846,8 +859,8 @@ namespace boost { namespace parser {
             Callbacks const & callbacks,
             GlobalState & globals,
             symbol_table_tries_t & symbol_table_tries,
-            pending_symbol_table_operations_t &
-                pending_symbol_table_operations) noexcept
+            pending_symbol_table_operations_t & pending_symbol_table_operations,
+            memo_tables_t & memo_tables) noexcept
         {
             return parse_context(
                 std::bool_constant<DoTrace>{},
@@ -860,7 +873,8 @@ namespace boost { namespace parser {
                 callbacks,
                 globals,
                 symbol_table_tries,
-                pending_symbol_table_operations);
+                pending_symbol_table_operations,
+                memo_tables);
         }
 
 
@@ -1061,6 +1075,10 @@ namespace boost { namespace parser {
         using has_push_back =
             decltype(std::declval<T &>().push_back(*std::declval<T>().begin()));
 
+        template<typename T, typename I>
+        using has_insert_at_end = decltype(std::declval<T &>().insert(
+            std::declval<T &>().end(), std::declval<I>(), std::declval<I>()));
+
 #if BOOST_PARSER_USE_CONCEPTS
 
         template<typename T>
@@ -1331,10 +1349,14 @@ namespace boost { namespace parser {
         template<typename Container, typename I>
         void insert(Container & c, I first, I last)
         {
-            std::for_each(first, last, [&](auto && x) {
-                using type = decltype(x);
-                insert(c, (type &&) x);
-            });
+            if constexpr (is_detected_v<has_insert_at_end, Container, I>) {
+                c.insert(c.end(), first, last);
+            } else {
+                std::for_each(first, last, [&](auto && x) {
+                    using type = decltype(x);
+                    insert(c, (type &&) x);
+                });
+            }
         }
 
         template<typename Container, typename T>
@@ -1521,6 +1543,7 @@ namespace boost { namespace parser {
             nope n;
             symbol_table_tries_t symbol_table_tries;
             pending_symbol_table_operations_t pending_symbol_table_operations;
+            memo_tables_t memo_tables;
             auto const context = detail::make_context<false, false>(
                 first,
                 last,
@@ -1529,7 +1552,8 @@ namespace boost { namespace parser {
                 eh,
                 n,
                 symbol_table_tries,
-                pending_symbol_table_operations);
+                pending_symbol_table_operations,
+                memo_tables);
             while (success) {
                 skip_(
                     first,
@@ -1612,8 +1636,14 @@ namespace boost { namespace parser {
                     last_idx_ = 1;
                     return;
                 }
+                char32_t const cp = *it_;
+                if (cp < 0x80) {
+                    folded_[0] = (0x41 <= cp && cp <= 0x5a) ? cp + 0x20 : cp;
+                    last_idx_ = 1;
+                    return;
+                }
                 auto const folded_last =
-                    detail::case_fold(*it_, folded_.begin());
+                    detail::case_fold(cp, folded_.begin());
                 last_idx_ = int(folded_last - folded_.begin());
             }
 
@@ -1653,11 +1683,13 @@ namespace boost { namespace parser {
             symbol_table_op kind_;
         };
 
+        // Returns true iff initial_elements was modified.
         template<typename T>
-        void apply_symbol_table_operations(
+        bool apply_symbol_table_operations(
             std::vector<std::pair<std::string, T>> & initial_elements,
             std::vector<symbol_table_operation<T>> & pending_operations)
         {
+            bool changed = false;
             auto lower_bound = [&initial_elements](std::string const & str) {
                 return std::lower_bound(
                     initial_elements.begin(),
@@ -1680,48 +1712,182 @@ namespace boost { namespace parser {
                     } else {
                         it->second = std::move(*op.value_);
                     }
+                    changed = true;
                 } else if (op.kind_ == symbol_table_op::erase) {
                     auto it = lower_bound(op.key_);
-                    if (it != initial_elements.end() && it->first == op.key_)
+                    if (it != initial_elements.end() &&
+                        it->first == op.key_) {
                         initial_elements.erase(it);
+                        changed = true;
+                    }
                 } else {
+                    changed |= !initial_elements.empty();
                     initial_elements.clear();
                 }
             }
 
             pending_operations.clear();
+            return changed;
         }
 
-        template<typename Context, typename T>
-        auto get_trie(
-            Context const & context, symbol_parser<T> const & sym_parser)
+        template<typename T>
+        using symbol_trie_t = text::trie_map<std::vector<char32_t>, T>;
+        template<typename T>
+        using frozen_symbol_trie_t =
+            text::frozen_trie_map<std::vector<char32_t>, T>;
+        template<typename T>
+        using frozen_utf8_symbol_trie_t =
+            text::frozen_trie_map<std::vector<char>, T>;
+
+        /** The tries compiled from the initial elements of a symbol table.
+            The UTF-8-keyed trie is only needed for lookups on transcoded
+            UTF-8 input, and the case-folded trie only for lookups under
+            no_case[], so each is built the first time such a lookup
+            happens. */
+        template<typename T>
+        struct compiled_symbol_tries
         {
-            using trie_t = text::trie_map<std::vector<char32_t>, T>;
-            using result_type = std::pair<trie_t &, bool>;
-            symbol_table_tries_t & symbol_table_tries =
-                *context.symbol_table_tries_;
+            explicit compiled_symbol_tries(
+                std::vector<std::pair<std::string, T>> const &
+                    initial_elements) :
+                trie_(make_trie(initial_elements))
+            {}
 
-            auto & [any, has_case_folded] =
-                symbol_table_tries[(void *)&sym_parser.ref()];
+            frozen_symbol_trie_t<T> const & trie() const { return trie_; }
 
-            bool const needs_case_folded = context.no_case_depth_;
+            frozen_utf8_symbol_trie_t<T> const & utf8_trie() const
+            {
+                std::call_once(utf8_once_, [this] {
+                    // Built from trie_ rather than the initial elements, so
+                    // that any ill-formed UTF-8 in the keys is replaced
+                    // exactly as it was in trie_.
+                    text::trie_map<std::vector<char>, T> utf8_trie;
+                    trie_.for_each([&](auto const & key, T const & value) {
+                        utf8_trie.insert(key | text::as_utf8, value);
+                    });
+                    utf8_trie_ = frozen_utf8_symbol_trie_t<T>(utf8_trie);
+                });
+                return utf8_trie_;
+            }
 
-            if (!any.has_value()) {
-                any = trie_t{};
-                has_case_folded = false;
-                trie_t & trie = *std::any_cast<trie_t>(&any);
-                for (auto const & e : sym_parser.initial_elements()) {
+            // Contains the elements of trie(), plus a case-folded copy of
+            // each one.
+            frozen_symbol_trie_t<T> const & case_folded_trie() const
+            {
+                std::call_once(case_folded_once_, [this] {
+                    symbol_trie_t<T> case_folded_trie = trie_.thaw();
+                    trie_.for_each([&](auto const & key, T const & value) {
+                        case_folded_trie.insert(
+                            case_fold_view(key | text::as_utf32), value);
+                    });
+                    case_folded_trie_ =
+                        frozen_symbol_trie_t<T>(case_folded_trie);
+                });
+                return case_folded_trie_;
+            }
+
+        private:
+            static frozen_symbol_trie_t<T>
+            make_trie(std::vector<std::pair<std::string, T>> const &
+                          initial_elements)
+            {
+                symbol_trie_t<T> trie;
+                for (auto const & e : initial_elements) {
                     trie.insert(e.first | text::as_utf32, e.second);
-                    if (needs_case_folded) {
-                        trie.insert(
-                            case_fold_view(e.first | text::as_utf32), e.second);
-                        has_case_folded = true;
-                    }
                 }
-                return result_type(trie, has_case_folded);
-            } else {
-                trie_t & trie = *std::any_cast<trie_t>(&any);
-                if (needs_case_folded && !has_case_folded) {
+                return frozen_symbol_trie_t<T>(trie);
+            }
+
+            frozen_symbol_trie_t<T> trie_;
+            mutable std::once_flag utf8_once_;
+            mutable frozen_utf8_symbol_trie_t<T> utf8_trie_;
+            mutable std::once_flag case_folded_once_;
+            mutable frozen_symbol_trie_t<T> case_folded_trie_;
+        };
+
+        /** The tries compiled from the initial elements of a symbol table.
+            They are built lazily on first use, and are shared by every
+            subsequent top-level parse until the initial elements change.
+            Copies start out empty, and recompile on first use. */
+        template<typename T>
+        struct symbol_trie_cache
+        {
+            using compiled_t = compiled_symbol_tries<T>;
+
+            symbol_trie_cache() = default;
+            symbol_trie_cache(symbol_trie_cache const &) {}
+            symbol_trie_cache & operator=(symbol_trie_cache const &)
+            {
+                invalidate();
+                return *this;
+            }
+
+            std::shared_ptr<compiled_t const>
+            get(std::vector<std::pair<std::string, T>> const &
+                    initial_elements) const
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!compiled_)
+                    compiled_ = std::make_shared<compiled_t>(initial_elements);
+                return compiled_;
+            }
+
+            void invalidate() const
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                compiled_.reset();
+            }
+
+            // Whether compiled is still the current compilation of the table.
+            bool holds(std::shared_ptr<compiled_t const> const & compiled) const
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                return compiled_ == compiled;
+            }
+
+        private:
+            mutable std::mutex mutex_;
+            mutable std::shared_ptr<compiled_t const> compiled_;
+        };
+
+        /** The per-parse view of a symbol table.  Lookups go to the shared,
+            compiled tries; the first mid-parse mutation makes a private copy
+            that lives only until the end of the current top-level parse.
+            Once a lookup under no_case[] has been made, the rest of the
+            parse uses the case-folded trie. */
+        template<typename T>
+        struct symbol_table_trie
+        {
+            using trie_t = symbol_trie_t<T>;
+
+            // Calls f with the trie that lookups should use in this parse.
+            template<typename F>
+            decltype(auto) visit(F && f) const
+            {
+                if (copy_)
+                    return f(*copy_);
+                return f(shared());
+            }
+            trie_t & get_mutable()
+            {
+                if (!copy_)
+                    copy_ = shared().thaw();
+                return *copy_;
+            }
+
+            // Returns the UTF-8-keyed trie, or nullptr if this parse has
+            // mutated its copy of the table, or has switched to the
+            // case-folded trie.
+            frozen_utf8_symbol_trie_t<T> const * utf8() const
+            {
+                return copy_ || case_folded_ ? nullptr
+                                             : &compiled_->utf8_trie();
+            }
+
+            void use_case_folded()
+            {
+                if (copy_) {
+                    trie_t & trie = *copy_;
                     trie_t new_trie = trie;
                     for (auto && [key, value] : trie) {
                         new_trie.insert(
@@ -1729,8 +1895,82 @@ namespace boost { namespace parser {
                     }
                     std::swap(new_trie, trie);
                 }
-                return result_type(trie, has_case_folded);
-             }
+                case_folded_ = true;
+            }
+
+            std::shared_ptr<compiled_symbol_tries<T> const> compiled_;
+            std::optional<trie_t> copy_;
+            bool case_folded_ = false;
+
+        private:
+            frozen_symbol_trie_t<T> const & shared() const
+            {
+                return case_folded_ ? compiled_->case_folded_trie()
+                                    : compiled_->trie();
+            }
+        };
+
+        template<typename I>
+        struct is_utf8_to_utf32_iter : std::false_type
+        {};
+        template<typename I, typename S, typename ErrorHandler>
+        struct is_utf8_to_utf32_iter<text::utf_iterator<
+            text::format::utf8,
+            text::format::utf32,
+            I,
+            S,
+            ErrorHandler>> : std::true_type
+        {};
+
+        template<typename Context, typename T>
+        symbol_table_trie<T> & get_symbol_table_trie(
+            Context const & context, symbol_parser<T> const & sym_parser)
+        {
+            symbol_table_tries_t & symbol_table_tries =
+                *context.symbol_table_tries_;
+
+            auto & [any, has_case_folded, from_earlier_parse] =
+                symbol_table_tries[(void *)&sym_parser.ref()];
+
+            // A parse_session keeps each table's view from one parse to the
+            // next.  The view can be reused if it is of the same, unmodified
+            // table, once this parse's state is reset.
+            if (from_earlier_parse) {
+                auto * trie = std::any_cast<symbol_table_trie<T>>(&any);
+                if (trie &&
+                    sym_parser.ref().trie_cache_.holds(trie->compiled_)) {
+                    trie->copy_.reset();
+                    trie->case_folded_ = false;
+                } else {
+                    any.reset();
+                }
+                has_case_folded = false;
+                from_earlier_parse = false;
+            }
+
+            if (!any.has_value()) {
+                any = symbol_table_trie<T>{
+                    sym_parser.ref().trie_cache_.get(
+                        sym_parser.initial_elements()),
+                    std::nullopt,
+                    false};
+                has_case_folded = false;
+            }
+
+            auto & retval = *std::any_cast<symbol_table_trie<T>>(&any);
+            if (context.no_case_depth_ && !has_case_folded) {
+                retval.use_case_folded();
+                has_case_folded = true;
+            }
+            return retval;
+        }
+
+        template<typename Context, typename T>
+        symbol_trie_t<T> & get_mutable_trie(
+            Context const & context, symbol_parser<T> const & sym_parser)
+        {
+            return detail::get_symbol_table_trie(context, sym_parser)
+                .get_mutable();
         }
 
         template<typename Context, typename T>
@@ -1750,13 +1990,122 @@ namespace boost { namespace parser {
                     std::vector<detail::symbol_table_operation<T>>>(
                     &entry.ops_);
                 entry.visit_ = [&sym_parser, ops_ptr = retval] {
-                    detail::apply_symbol_table_operations(
-                        sym_parser.initial_elements_, *ops_ptr);
+                    if (detail::apply_symbol_table_operations(
+                            sym_parser.initial_elements_, *ops_ptr)) {
+                        sym_parser.trie_cache_.invalidate();
+                    }
                 };
             }
             return *retval;
         }
 
+        template<typename Iter>
+        using base_expr = decltype(std::declval<Iter const &>().base());
+
+        // Returns the offset of it from first.  This is constant-time for
+        // random access iterators, and for iterators like utf_iterator that
+        // adapt them, whose offsets are measured in underlying elements.
+        template<typename Iter>
+        std::ptrdiff_t memo_position(Iter const & first, Iter const & it)
+        {
+            using category_t =
+                typename std::iterator_traits<Iter>::iterator_category;
+            if constexpr (std::is_base_of_v<
+                              std::random_access_iterator_tag,
+                              category_t>) {
+                return it - first;
+            } else if constexpr (is_detected_v<base_expr, Iter>) {
+                return detail::memo_position(first.base(), it.base());
+            } else {
+                return std::distance(first, it);
+            }
+        }
+
+        // Everything that can make two attempts to parse at the same position
+        // come out differently.
+        struct memo_key
+        {
+            std::ptrdiff_t position_;
+            flags flags_;
+            int no_case_depth_;
+            void const * skip_;
+
+            friend bool operator<(memo_key const & lhs, memo_key const & rhs)
+            {
+                return std::tie(
+                           lhs.position_,
+                           lhs.flags_,
+                           lhs.no_case_depth_,
+                           lhs.skip_) <
+                       std::tie(
+                           rhs.position_,
+                           rhs.flags_,
+                           rhs.no_case_depth_,
+                           rhs.skip_);
+            }
+        };
+
+        template<typename Iter, typename Attr>
+        struct memo_result
+        {
+            Iter end_;
+            bool success_;
+            Attr attr_;
+        };
+
+        template<typename Iter, typename Attr>
+        using memo_table_t = std::map<memo_key, memo_result<Iter, Attr>>;
+
+        template<typename T>
+        inline constexpr char memo_type_id = 0;
+
+        // Memoized rules without parameters are identified by their tag, so
+        // that all the memoize[] uses of a rule share one table.  Any other
+        // parser is identified by its address.
+        template<typename Parser>
+        struct memo_parser_id
+        {
+            static void const * call(Parser const & parser)
+            {
+                return std::addressof(parser);
+            }
+        };
+
+        template<
+            bool CanUseCallbacks,
+            typename TagType,
+            typename Attribute,
+            typename LocalState>
+        struct memo_parser_id<
+            rule_parser<CanUseCallbacks, TagType, Attribute, LocalState, nope>>
+        {
+            static void const *
+            call(rule_parser<
+                 CanUseCallbacks,
+                 TagType,
+                 Attribute,
+                 LocalState,
+                 nope> const &)
+            {
+                return &memo_type_id<TagType>;
+            }
+        };
+
+        template<typename Iter, typename Attr, typename Context, typename Parser>
+        memo_table_t<Iter, Attr> &
+        get_memo_table(Context const & context, Parser const & parser)
+        {
+            using table_t = memo_table_t<Iter, Attr>;
+            memo_tables_t & memo_tables = *context.memo_tables_;
+            std::any & any = memo_tables[std::pair(
+                memo_parser_id<Parser>::call(parser),
+                static_cast<void const *>(
+                    &memo_type_id<std::pair<Parser, table_t>>))];
+            if (!any.has_value())
+                any = table_t{};
+            return *std::any_cast<table_t>(&any);
+        }
+
         template<>
         struct char_subranges<hex_digit_subranges>
         {
@@ -1776,9 +2125,50 @@ namespace boost { namespace parser {
                 {U'\u0000', U'\u001f'}, {U'\u007f', U'\u009f'}};
         };
 
+        constexpr bool is_ascii_letter(uint32_t cp)
+        {
+            return (0x41 <= cp && cp <= 0x5a) || (0x61 <= cp && cp <= 0x7a);
+        }
+
+        constexpr uint32_t ascii_other_case(uint32_t cp)
+        {
+            return detail::is_ascii_letter(cp) ? cp ^ 0x20 : cp;
+        }
+
+        struct ascii_bitset
+        {
+            constexpr void insert(uint32_t cp)
+            {
+                bits_[cp / 64] |= uint64_t(1) << (cp % 64);
+            }
+
+            constexpr bool contains(uint32_t cp) const
+            {
+                return (bits_[cp / 64] >> (cp % 64)) & 1;
+            }
+
+            uint64_t bits_[2] = {0, 0};
+        };
+
         template<typename Iter, typename Sentinel, bool SortedUTF32>
         struct char_range
         {
+            constexpr char_range() = default;
+            constexpr char_range(BOOST_PARSER_SUBRANGE<Iter, Sentinel> chars) :
+                chars_(chars)
+            {
+                for (auto c : chars_) {
+                    uint32_t const cp = c;
+                    if (0x80 <= cp) {
+                        has_non_ascii_ = true;
+                    } else {
+                        ascii_.insert(cp);
+                        ascii_no_case_.insert(cp);
+                        ascii_no_case_.insert(detail::ascii_other_case(cp));
+                    }
+                }
+            }
+
             template<typename T, typename Context>
             bool contains(T c_, Context const & context) const
             {
@@ -1786,6 +2176,24 @@ namespace boost { namespace parser {
                     return std::binary_search(chars_.begin(), chars_.end(), c_);
                 }
 
+                // ASCII elements, which are the same in every encoding, are
+                // looked up in the bitsets.  Since non-ASCII code points may
+                // fold to ASCII ones, the other elements must still be
+                // searched under no_case[], if the bitset does not match.
+                uint32_t const cp = c_;
+                if (cp < 0x80) {
+                    if (!context.no_case_depth_)
+                        return ascii_.contains(cp);
+                    if (ascii_no_case_.contains(cp))
+                        return true;
+                    if (!has_non_ascii_)
+                        return false;
+                } else if (
+                    std::is_same_v<T, char32_t> && !has_non_ascii_ &&
+                    !context.no_case_depth_) {
+                    return false;
+                }
+
                 if (context.no_case_depth_) {
                     case_fold_array_t folded;
                     auto folded_last = detail::case_fold(c_, folded.begin());
@@ -1826,6 +2234,9 @@ namespace boost { namespace parser {
             }
 
             BOOST_PARSER_SUBRANGE<Iter, Sentinel> chars_;
+            ascii_bitset ascii_;
+            ascii_bitset ascii_no_case_;
+            bool has_non_ascii_ = false;
         };
 
         template<bool SortedUTF32, typename Iter, typename Sentinel>
@@ -2274,96 +2685,509 @@ namespace boost { namespace parser {
         constexpr bool has_parsers_data_member_v =
             is_detected_v<has_parsers_data_member_expr, Parser>;
 
-        struct scoped_apply_pending_symbol_table_operations
+        template<typename Iter>
+        constexpr bool is_contiguous_char_iter_v =
+#if BOOST_PARSER_USE_CONCEPTS
+            std::contiguous_iterator<Iter> &&
+#else
+            (std::is_pointer_v<Iter> ||
+             std::is_same_v<Iter, std::string::const_iterator> ||
+             std::is_same_v<Iter, std::string::iterator> ||
+             std::is_same_v<Iter, std::string_view::const_iterator> ||
+             std::is_same_v<Iter, std::vector<char>::const_iterator> ||
+             std::is_same_v<Iter, std::vector<char>::iterator>) &&
+#endif
+            std::is_integral_v<iter_value_t<Iter>> &&
+            sizeof(iter_value_t<Iter>) == 1;
+
+        template<typename T>
+        constexpr bool is_ascii_value(T x)
         {
-            scoped_apply_pending_symbol_table_operations(
-                pending_symbol_table_operations_t & pending_ops) :
-                pending_ops_(pending_ops)
-            {}
+            return uint32_t(x) < 0x80;
+        }
+
+        /** Whether a parser only ever matches ASCII code points, each the
+            same way regardless of what surrounds it, and never inspects the
+            parse context.  Such a parser matches transcoded UTF-8 input
+            exactly as it matches the underlying code units, so the top-level
+            parse functions run it on the code units directly.  Specializations
+            provide a constexpr static call(parser) that checks the parser's
+            runtime values (e.g. that its literals are ASCII). */
+        template<typename Parser, typename Enable = void>
+        struct ascii_only_impl
+        {};
+
+        template<typename Parser>
+        using ascii_only_call = decltype(ascii_only_impl<Parser>::call(
+            std::declval<Parser const &>()));
+
+        template<typename Parser>
+        constexpr bool has_ascii_only_v = is_detected_v<ascii_only_call, Parser>;
+
+        template<typename Parser>
+        constexpr bool ascii_only(Parser const & parser)
+        {
+            return ascii_only_impl<Parser>::call(parser);
+        }
+
+        template<>
+        struct ascii_only_impl<null_parser>
+        {
+            static constexpr bool call(null_parser const &) { return true; }
+        };
 
-            ~scoped_apply_pending_symbol_table_operations()
+        template<typename Expected, typename AttributeType>
+        struct ascii_only_impl<
+            char_parser<Expected, AttributeType>,
+            std::enable_if_t<std::is_integral_v<Expected>>>
+        {
+            static constexpr bool
+            call(char_parser<Expected, AttributeType> const & parser)
             {
-                for (auto & [_, entry] : pending_ops_) {
-                    entry.visit_();
-                }
+                return detail::is_ascii_value(parser.expected_);
             }
+        };
 
-            pending_symbol_table_operations_t & pending_ops_;
+        template<typename LoType, typename HiType, typename AttributeType>
+        struct ascii_only_impl<
+            char_parser<char_pair<LoType, HiType>, AttributeType>,
+            std::enable_if_t<
+                std::is_integral_v<LoType> && std::is_integral_v<HiType>>>
+        {
+            static constexpr bool call(
+                char_parser<char_pair<LoType, HiType>, AttributeType> const &
+                    parser)
+            {
+                return detail::is_ascii_value(parser.expected_.lo_) &&
+                       detail::is_ascii_value(parser.expected_.hi_);
+            }
         };
 
         template<
-            bool Debug,
             typename Iter,
             typename Sentinel,
-            typename Parser,
-            typename Attr,
-            typename ErrorHandler>
-        bool parse_impl(
-            Iter & first,
-            Sentinel last,
-            Parser const & parser,
-            ErrorHandler const & error_handler,
-            Attr & attr)
+            bool SortedUTF32,
+            typename AttributeType>
+        struct ascii_only_impl<char_parser<
+            char_range<Iter, Sentinel, SortedUTF32>,
+            AttributeType>>
+        {
+            static constexpr bool call(
+                char_parser<
+                    char_range<Iter, Sentinel, SortedUTF32>,
+                    AttributeType> const & parser)
+            {
+                for (auto c : parser.expected_.chars_) {
+                    if (!detail::is_ascii_value(c))
+                        return false;
+                }
+                return true;
+            }
+        };
+
+        template<typename StrIter, typename StrSentinel>
+        struct ascii_only_impl<string_parser<StrIter, StrSentinel>>
         {
-            auto const initial_first = first;
-            bool success = true;
-            int trace_indent = 0;
-            detail::symbol_table_tries_t symbol_table_tries;
-            pending_symbol_table_operations_t pending_symbol_table_operations;
-            scoped_apply_pending_symbol_table_operations apply_pending(
-                pending_symbol_table_operations);
-            auto context = detail::make_context<Debug, false>(
-                first,
-                last,
-                success,
-                trace_indent,
-                error_handler,
-                parser.globals_,
-                symbol_table_tries,
-                pending_symbol_table_operations);
-            auto const flags =
-                Debug ? detail::enable_trace(detail::flags::gen_attrs)
-                      : detail::flags::gen_attrs;
-            try {
-                parser(
-                    first,
-                    last,
-                    context,
-                    detail::null_parser{},
-                    flags,
-                    success,
-                    attr);
-                if (Debug)
-                    detail::final_trace(context, flags, attr);
-                return success;
-            } catch (parse_error<Iter> const & e) {
-                if (error_handler(initial_first, last, e) ==
-                    error_handler_result::rethrow) {
-                    throw;
+            static constexpr bool
+            call(string_parser<StrIter, StrSentinel> const & parser)
+            {
+                for (auto it = parser.expected_first_;
+                     it != parser.expected_last_;
+                     ++it) {
+                    if (!detail::is_ascii_value(*it))
+                        return false;
                 }
-                return false;
+                return true;
             }
-        }
+        };
 
-        template<
-            bool Debug,
-            typename Iter,
-            typename Sentinel,
-            typename Parser,
-            typename ErrorHandler>
-        auto parse_impl(
-            Iter & first,
-            Sentinel last,
-            Parser const & parser,
-            ErrorHandler const & error_handler)
+        // Parsers that only ever match ASCII.
+        struct ascii_only_always
         {
-            auto const initial_first = first;
+            template<typename Parser>
+            static constexpr bool call(Parser const &)
+            {
+                return true;
+            }
+        };
+
+        template<>
+        struct ascii_only_impl<eps_parser<nope>> : ascii_only_always
+        {};
+        template<>
+        struct ascii_only_impl<eoi_parser> : ascii_only_always
+        {};
+        template<>
+        struct ascii_only_impl<bool_parser> : ascii_only_always
+        {};
+        template<
+            typename T,
+            int Radix,
+            int MinDigits,
+            int MaxDigits,
+            typename Expected>
+        struct ascii_only_impl<
+            uint_parser<T, Radix, MinDigits, MaxDigits, Expected>>
+            : ascii_only_always
+        {};
+        template<
+            typename T,
+            int Radix,
+            int MinDigits,
+            int MaxDigits,
+            typename Expected>
+        struct ascii_only_impl<
+            int_parser<T, Radix, MinDigits, MaxDigits, Expected>>
+            : ascii_only_always
+        {};
+        template<typename T, typename Policies>
+        struct ascii_only_impl<float_parser<T, Policies>> : ascii_only_always
+        {};
+
+        // Parsers that are ASCII-only if their subparser is.
+        template<typename Parser>
+        struct ascii_only_of_subparser
+        {
+            template<typename WrappingParser>
+            static constexpr bool call(WrappingParser const & parser)
+            {
+                return ascii_only_impl<Parser>::call(parser.parser_);
+            }
+        };
+
+        template<typename Parser>
+        struct ascii_only_impl<
+            opt_parser<Parser>,
+            std::enable_if_t<has_ascii_only_v<Parser>>>
+            : ascii_only_of_subparser<Parser>
+        {};
+
+        template<typename Parser, typename F>
+        struct ascii_only_impl<
+            transform_parser<Parser, F>,
+            std::enable_if_t<has_ascii_only_v<Parser>>>
+            : ascii_only_of_subparser<Parser>
+        {};
+
+        template<typename Parser>
+        struct ascii_only_impl<
+            omit_parser<Parser>,
+            std::enable_if_t<has_ascii_only_v<Parser>>>
+            : ascii_only_of_subparser<Parser>
+        {};
+
+        template<typename Parser>
+        struct ascii_only_impl<
+            raw_parser<Parser>,
+            std::enable_if_t<has_ascii_only_v<Parser>>>
+            : ascii_only_of_subparser<Parser>
+        {};
+
+        template<typename Parser>
+        struct ascii_only_impl<
+            lexeme_parser<Parser>,
+            std::enable_if_t<has_ascii_only_v<Parser>>>
+            : ascii_only_of_subparser<Parser>
+        {};
+
+        template<typename Parser>
+        struct ascii_only_impl<
+            memoize_parser<Parser>,
+            std::enable_if_t<has_ascii_only_v<Parser>>>
+            : ascii_only_of_subparser<Parser>
+        {};
+
+        template<typename Parser, bool FailOnMatch>
+        struct ascii_only_impl<
+            expect_parser<Parser, FailOnMatch>,
+            std::enable_if_t<has_ascii_only_v<Parser>>>
+            : ascii_only_of_subparser<Parser>
+        {};
+
+        template<typename Parser>
+        struct ascii_only_impl<
+            skip_parser<Parser, nope>,
+            std::enable_if_t<has_ascii_only_v<Parser>>>
+            : ascii_only_of_subparser<Parser>
+        {};
+
+        template<typename Parser, typename SkipParser>
+        struct ascii_only_impl<
+            skip_parser<Parser, parser_interface<SkipParser>>,
+            std::enable_if_t<
+                has_ascii_only_v<Parser> && has_ascii_only_v<SkipParser>>>
+        {
+            static constexpr bool call(
+                skip_parser<Parser, parser_interface<SkipParser>> const &
+                    parser)
+            {
+                return ascii_only_impl<Parser>::call(parser.parser_) &&
+                       ascii_only_impl<SkipParser>::call(
+                           parser.skip_parser_.parser_);
+            }
+        };
+
+        template<typename Parser, typename DelimiterParser>
+        struct ascii_only_impl<
+            repeat_parser<Parser, DelimiterParser>,
+            std::enable_if_t<
+                has_ascii_only_v<Parser> &&
+                (is_nope_v<DelimiterParser> ||
+                 has_ascii_only_v<DelimiterParser>)>>
+        {
+            static constexpr bool
+            call(repeat_parser<Parser, DelimiterParser> const & parser)
+            {
+                if (!ascii_only_impl<Parser>::call(parser.parser_))
+                    return false;
+                if constexpr (is_nope_v<DelimiterParser>) {
+                    return true;
+                } else {
+                    return ascii_only_impl<DelimiterParser>::call(
+                        parser.delimiter_parser_);
+                }
+            }
+        };
+
+        template<typename Parser>
+        struct ascii_only_impl<zero_plus_parser<Parser>>
+            : ascii_only_impl<repeat_parser<Parser>>
+        {};
+
+        template<typename Parser>
+        struct ascii_only_impl<one_plus_parser<Parser>>
+            : ascii_only_impl<repeat_parser<Parser>>
+        {};
+
+        template<typename Parser, typename DelimiterParser>
+        struct ascii_only_impl<delimited_seq_parser<Parser, DelimiterParser>>
+            : ascii_only_impl<repeat_parser<Parser, DelimiterParser>>
+        {};
+
+        // Parsers that are ASCII-only if all their subparsers are.
+        struct ascii_only_of_subparsers
+        {
+            template<typename CombiningParser>
+            static constexpr bool call(CombiningParser const & parser)
+            {
+                bool retval = true;
+                detail::hl::for_each(
+                    parser.parsers_, [&retval](auto const & subparser) {
+                        retval = retval &&
+                                 ascii_only_impl<remove_cv_ref_t<decltype(
+                                     subparser)>>::call(subparser);
+                    });
+                return retval;
+            }
+        };
+
+        template<
+            typename... Parsers,
+            typename BacktrackingTuple,
+            typename CombiningGroups>
+        struct ascii_only_impl<
+            seq_parser<tuple<Parsers...>, BacktrackingTuple, CombiningGroups>,
+            std::enable_if_t<(has_ascii_only_v<Parsers> && ...)>>
+            : ascii_only_of_subparsers
+        {};
+
+        template<typename... Parsers>
+        struct ascii_only_impl<
+            or_parser<tuple<Parsers...>>,
+            std::enable_if_t<(has_ascii_only_v<Parsers> && ...)>>
+            : ascii_only_of_subparsers
+        {};
+
+        template<typename... Parsers>
+        struct ascii_only_impl<
+            perm_parser<tuple<Parsers...>>,
+            std::enable_if_t<(has_ascii_only_v<Parsers> && ...)>>
+            : ascii_only_of_subparsers
+        {};
+
+        /** Whether a top-level parse of [first, last), using Parser (a
+            parser_interface) and skipper SkipParser (a parser_interface's
+            parser_type, or null_parser), may be run on the underlying code
+            units instead.  This requires that [first, last) be UTF-8
+            transcoded to UTF-32 from contiguous storage, and that running on
+            the code units produce the same attribute type.  Traces always
+            show the transcoded input. */
+        template<
+            bool Debug,
+            typename Iter,
+            typename Sentinel,
+            typename Parser,
+            typename SkipParser>
+        constexpr bool can_parse_as_ascii_bytes()
+        {
+            if constexpr (Debug || !is_utf8_to_utf32_iter<Iter>::value) {
+                return false;
+            } else {
+                using unpacked_t =
+                    decltype(text::unpack_iterator_and_sentinel(
+                        std::declval<Iter>(), std::declval<Sentinel>()));
+                using raw_iter = decltype(std::declval<unpacked_t>().first);
+                using raw_sentinel = decltype(std::declval<unpacked_t>().last);
+                if constexpr (
+                    !std::is_same_v<raw_iter, raw_sentinel> ||
+                    !is_contiguous_char_iter_v<raw_iter>) {
+                    return false;
+                } else if constexpr (
+                    !has_ascii_only_v<typename Parser::parser_type> ||
+                    !has_ascii_only_v<SkipParser>) {
+                    return false;
+                } else {
+                    using attr_t = typename attribute_impl<
+                        BOOST_PARSER_SUBRANGE<std::remove_const_t<Iter>, Sentinel>,
+                        Parser>::type;
+                    using bytes_attr_t = typename attribute_impl<
+                        BOOST_PARSER_SUBRANGE<char const *>,
+                        Parser>::type;
+                    return std::is_same_v<attr_t, bytes_attr_t>;
+                }
+            }
+        }
+
+        /** Calls parse(f, l, eh) on the code units underlying [first,
+            last), as a range of char const *, then moves first past the code
+            units f was moved past.  parse must use the error handler eh,
+            which rethrows every parse_error<char const *>; such an error is
+            rethrown as a parse_error<Iter> and given to error_handler, so
+            that the caller sees the same errors as if it had parsed [first,
+            last) itself. */
+        template<
+            typename Iter,
+            typename Sentinel,
+            typename ErrorHandler,
+            typename F>
+        auto parse_as_ascii_bytes(
+            Iter & first,
+            Sentinel last,
+            ErrorHandler const & error_handler,
+            F const & parse)
+        {
+            auto const unpacked =
+                text::unpack_iterator_and_sentinel(first, last);
+            char const * const raw_first = reinterpret_cast<char const *>(
+                std::addressof(*unpacked.first));
+            char const * f = raw_first;
+            char const * const l = f + (unpacked.last - unpacked.first);
+            auto const to_iter = [&](char const * it) {
+                return unpacked.repack(
+                    std::next(unpacked.first, it - raw_first));
+            };
+            auto const initial_first = first;
+            try {
+                auto retval = parse(f, l, rethrow_error_handler{});
+                first = to_iter(f);
+                return retval;
+            } catch (parse_error<char const *> const & e) {
+                first = to_iter(f);
+                parse_error<Iter> const iter_error(to_iter(e.iter), e.what());
+                if (error_handler(initial_first, last, iter_error) ==
+                    error_handler_result::rethrow) {
+                    throw iter_error;
+                }
+                return decltype(parse(f, l, rethrow_error_handler{})){};
+            }
+        }
+
+        struct parse_tables
+        {
+            symbol_table_tries_t symbol_table_tries_;
+            pending_symbol_table_operations_t pending_symbol_table_operations_;
+            memo_tables_t memo_tables_;
+        };
+
+        // The tables of the parse_session making the next top-level parse on
+        // this thread, if any.
+        inline parse_tables *& session_parse_tables()
+        {
+            static thread_local parse_tables * tables = nullptr;
+            return tables;
+        }
+
+        // The tables used by one top-level parse.  A parse made through a
+        // parse_session uses the session's tables; any other parse, including
+        // one made by a semantic action during a session's parse, has its
+        // own.  Pending symbol table operations are applied when the parse
+        // ends.
+        struct scoped_parse_tables
+        {
+            scoped_parse_tables() :
+                session_tables_(
+                    std::exchange(detail::session_parse_tables(), nullptr))
+            {
+                if (session_tables_) {
+                    for (auto & [_, entry] :
+                         session_tables_->symbol_table_tries_) {
+                        entry.from_earlier_parse_ = true;
+                    }
+                }
+            }
+
+            ~scoped_parse_tables()
+            {
+                parse_tables & tables = **this;
+                for (auto & [_, entry] :
+                     tables.pending_symbol_table_operations_) {
+                    entry.visit_();
+                }
+                if (session_tables_) {
+                    tables.pending_symbol_table_operations_.clear();
+                    tables.memo_tables_.clear();
+                }
+            }
+
+            parse_tables & operator*()
+            {
+                return session_tables_ ? *session_tables_ : own_tables_;
+            }
+
+        private:
+            parse_tables * session_tables_;
+            parse_tables own_tables_;
+        };
+
+        template<
+            bool Debug,
+            typename Iter,
+            typename Sentinel,
+            typename Parser,
+            typename Attr,
+            typename ErrorHandler>
+        bool parse_impl(
+            Iter & first,
+            Sentinel last,
+            Parser const & parser,
+            ErrorHandler const & error_handler,
+            Attr & attr)
+        {
+            if constexpr (detail::can_parse_as_ascii_bytes<
+                              Debug,
+                              Iter,
+                              Sentinel,
+                              Parser,
+                              null_parser>()) {
+                if (first != last && detail::ascii_only(parser.parser_)) {
+                    return detail::parse_as_ascii_bytes(
+                        first,
+                        last,
+                        error_handler,
+                        [&](char const *& f,
+                            char const * l,
+                            rethrow_error_handler const & eh) {
+                            return detail::parse_impl<Debug>(
+                                f, l, parser, eh, attr);
+                        });
+                }
+            }
+
+            auto const initial_first = first;
             bool success = true;
             int trace_indent = 0;
-            detail::symbol_table_tries_t symbol_table_tries;
-            pending_symbol_table_operations_t pending_symbol_table_operations;
-            scoped_apply_pending_symbol_table_operations apply_pending(
-                pending_symbol_table_operations);
+            scoped_parse_tables scoped_tables;
+            parse_tables & tables = *scoped_tables;
             auto context = detail::make_context<Debug, false>(
                 first,
                 last,
@@ -2371,8 +3195,80 @@ namespace boost { namespace parser {
                 trace_indent,
                 error_handler,
                 parser.globals_,
-                symbol_table_tries,
-                pending_symbol_table_operations);
+                tables.symbol_table_tries_,
+                tables.pending_symbol_table_operations_,
+                tables.memo_tables_);
+            auto const flags =
+                Debug ? detail::enable_trace(detail::flags::gen_attrs)
+                      : detail::flags::gen_attrs;
+            try {
+                parser(
+                    first,
+                    last,
+                    context,
+                    detail::null_parser{},
+                    flags,
+                    success,
+                    attr);
+                if (Debug)
+                    detail::final_trace(context, flags, attr);
+                return success;
+            } catch (parse_error<Iter> const & e) {
+                if (error_handler(initial_first, last, e) ==
+                    error_handler_result::rethrow) {
+                    throw;
+                }
+                return false;
+            }
+        }
+
+        template<
+            bool Debug,
+            typename Iter,
+            typename Sentinel,
+            typename Parser,
+            typename ErrorHandler>
+        auto parse_impl(
+            Iter & first,
+            Sentinel last,
+            Parser const & parser,
+            ErrorHandler const & error_handler)
+        {
+            if constexpr (detail::can_parse_as_ascii_bytes<
+                              Debug,
+                              Iter,
+                              Sentinel,
+                              Parser,
+                              null_parser>()) {
+                if (first != last && detail::ascii_only(parser.parser_)) {
+                    return detail::parse_as_ascii_bytes(
+                        first,
+                        last,
+                        error_handler,
+                        [&](char const *& f,
+                            char const * l,
+                            rethrow_error_handler const & eh) {
+                            return detail::parse_impl<Debug>(
+                                f, l, parser, eh);
+                        });
+                }
+            }
+
+            auto const initial_first = first;
+            bool success = true;
+            int trace_indent = 0;
+            scoped_parse_tables scoped_tables;
+            parse_tables & tables = *scoped_tables;
+            auto context = detail::make_context<Debug, false>(
+                first,
+                last,
+                success,
+                trace_indent,
+                error_handler,
+                parser.globals_,
+                tables.symbol_table_tries_,
+                tables.pending_symbol_table_operations_,
+                tables.memo_tables_);
             auto const flags =
                 Debug ? detail::enable_trace(detail::flags::gen_attrs)
                       : detail::flags::gen_attrs;
@@ -2417,10 +3313,8 @@ namespace boost { namespace parser {
             auto const initial_first = first;
             bool success = true;
             int trace_indent = 0;
-            detail::symbol_table_tries_t symbol_table_tries;
-            pending_symbol_table_operations_t pending_symbol_table_operations;
-            scoped_apply_pending_symbol_table_operations apply_pending(
-                pending_symbol_table_operations);
+            scoped_parse_tables scoped_tables;
+            parse_tables & tables = *scoped_tables;
             auto context = detail::make_context<Debug, true>(
                 first,
                 last,
@@ -2429,8 +3323,9 @@ namespace boost { namespace parser {
                 error_handler,
                 callbacks,
                 parser.globals_,
-                symbol_table_tries,
-                pending_symbol_table_operations);
+                tables.symbol_table_tries_,
+                tables.pending_symbol_table_operations_,
+                tables.memo_tables_);
             auto const flags =
                 Debug ? detail::enable_trace(detail::flags::gen_attrs)
                       : detail::flags::gen_attrs;
@@ -2470,13 +3365,32 @@ namespace boost { namespace parser {
             ErrorHandler const & error_handler,
             Attr & attr)
         {
+            if constexpr (detail::can_parse_as_ascii_bytes<
+                              Debug,
+                              Iter,
+                              Sentinel,
+                              Parser,
+                              typename SkipParser::parser_type>()) {
+                if (first != last && detail::ascii_only(parser.parser_) &&
+                    detail::ascii_only(skip.parser_)) {
+                    return detail::parse_as_ascii_bytes(
+                        first,
+                        last,
+                        error_handler,
+                        [&](char const *& f,
+                            char const * l,
+                            rethrow_error_handler const & eh) {
+                            return detail::skip_parse_impl<Debug>(
+                                f, l, parser, skip, eh, attr);
+                        });
+                }
+            }
+
             auto const initial_first = first;
             bool success = true;
             int trace_indent = 0;
-            detail::symbol_table_tries_t symbol_table_tries;
-            pending_symbol_table_operations_t pending_symbol_table_operations;
-            scoped_apply_pending_symbol_table_operations apply_pending(
-                pending_symbol_table_operations);
+            scoped_parse_tables scoped_tables;
+            parse_tables & tables = *scoped_tables;
             auto context = detail::make_context<Debug, false>(
                 first,
                 last,
@@ -2484,8 +3398,9 @@ namespace boost { namespace parser {
                 trace_indent,
                 error_handler,
                 parser.globals_,
-                symbol_table_tries,
-                pending_symbol_table_operations);
+                tables.symbol_table_tries_,
+                tables.pending_symbol_table_operations_,
+                tables.memo_tables_);
             auto const flags =
                 Debug ? detail::enable_trace(detail::default_flags())
                       : detail::default_flags();
@@ -2519,13 +3434,32 @@ namespace boost { namespace parser {
             SkipParser const & skip,
             ErrorHandler const & error_handler)
         {
+            if constexpr (detail::can_parse_as_ascii_bytes<
+                              Debug,
+                              Iter,
+                              Sentinel,
+                              Parser,
+                              typename SkipParser::parser_type>()) {
+                if (first != last && detail::ascii_only(parser.parser_) &&
+                    detail::ascii_only(skip.parser_)) {
+                    return detail::parse_as_ascii_bytes(
+                        first,
+                        last,
+                        error_handler,
+                        [&](char const *& f,
+                            char const * l,
+                            rethrow_error_handler const & eh) {
+                            return detail::skip_parse_impl<Debug>(
+                                f, l, parser, skip, eh);
+                        });
+                }
+            }
+
             auto const initial_first = first;
             bool success = true;
             int trace_indent = 0;
-            detail::symbol_table_tries_t symbol_table_tries;
-            pending_symbol_table_operations_t pending_symbol_table_operations;
-            scoped_apply_pending_symbol_table_operations apply_pending(
-                pending_symbol_table_operations);
+            scoped_parse_tables scoped_tables;
+            parse_tables & tables = *scoped_tables;
             auto context = detail::make_context<Debug, false>(
                 first,
                 last,
@@ -2533,8 +3467,9 @@ namespace boost { namespace parser {
                 trace_indent,
                 error_handler,
                 parser.globals_,
-                symbol_table_tries,
-                pending_symbol_table_operations);
+                tables.symbol_table_tries_,
+                tables.pending_symbol_table_operations_,
+                tables.memo_tables_);
             auto const flags =
                 Debug ? detail::enable_trace(detail::default_flags())
                       : detail::default_flags();
@@ -2578,10 +3513,8 @@ namespace boost { namespace parser {
             auto const initial_first = first;
             bool success = true;
             int trace_indent = 0;
-            detail::symbol_table_tries_t symbol_table_tries;
-            pending_symbol_table_operations_t pending_symbol_table_operations;
-            scoped_apply_pending_symbol_table_operations apply_pending(
-                pending_symbol_table_operations);
+            scoped_parse_tables scoped_tables;
+            parse_tables & tables = *scoped_tables;
             auto context = detail::make_context<Debug, true>(
                 first,
                 last,
@@ -2590,8 +3523,9 @@ namespace boost { namespace parser {
                 error_handler,
                 callbacks,
                 parser.globals_,
-                symbol_table_tries,
-                pending_symbol_table_operations);
+                tables.symbol_table_tries_,
+                tables.pending_symbol_table_operations_,
+                tables.memo_tables_);
             auto const flags =
                 Debug ? detail::enable_trace(detail::default_flags())
                       : detail::default_flags();
@@ -2849,31 +3783,941 @@ namespace boost { namespace parser {
         private:
             T * x_;
         };
-    }
 
-#ifndef BOOST_PARSER_DOXYGEN
+        /** The ASCII code points that a match of some parser can begin with.
+            Used by or_parser to rule out alternatives by looking at the next
+            code point of input.  Any superset of the true set is correct. */
+        struct first_set
+        {
+            static constexpr first_set all()
+            {
+                first_set retval;
+                retval.ascii_[0] = ~uint64_t(0);
+                retval.ascii_[1] = ~uint64_t(0);
+                retval.no_case_exact_ = false;
+                return retval;
+            }
 
-    // This constraint is only here to allow the alternate-call semantic
-    // action metaprogramming logic to function on MSVC.
-    template<typename Context>
-    auto _val(Context const & context) -> std::conditional_t<
-        detail::is_nope_v<decltype(*context.val_)>,
-        none,
-        decltype(*context.val_)>
-    {
-        if constexpr (detail::is_nope_v<decltype(*context.val_)>)
-            return none{};
-        else
-            return *context.val_;
-    }
+            constexpr void insert(uint32_t cp)
+            {
+                if (cp < 0x80)
+                    ascii_[cp / 64] |= uint64_t(1) << (cp % 64);
+                else
+                    no_case_exact_ = false;
+            }
 
-    template<typename Context>
-    decltype(auto) _attr(Context const & context)
-    {
-        if constexpr (detail::is_nope_v<decltype(*context.attr_)>)
-            return none{};
-        else
-            return *context.attr_;
+            // Inserts the closed range [lo, hi].
+            constexpr void insert(uint32_t lo, uint32_t hi)
+            {
+                for (uint32_t cp = lo; cp <= hi && cp < 0x80; ++cp) {
+                    insert(cp);
+                }
+                if (0x80 <= hi)
+                    no_case_exact_ = false;
+            }
+
+            constexpr bool contains(uint32_t cp) const
+            {
+                return (ascii_[cp / 64] >> (cp % 64)) & 1;
+            }
+
+            uint64_t ascii_[2] = {0, 0};
+            // False if, under no_case[], the parser may match an ASCII code
+            // point c such that neither c nor its other-case letter is in
+            // the set.  This is the case for any parser that may match a
+            // non-ASCII code point, since some of those fold to ASCII.
+            bool no_case_exact_ = true;
+        };
+
+        // Specializations provide a constexpr static call(parser) that
+        // returns the parser's first_set.  Parsers without one (e.g. those
+        // that can match without consuming input) are never ruled out.
+        template<typename Parser, typename Enable = void>
+        struct first_set_impl
+        {};
+
+        template<typename Parser>
+        using first_set_call = decltype(first_set_impl<Parser>::call(
+            std::declval<Parser const &>()));
+
+        template<typename Parser>
+        constexpr bool has_first_set_v = is_detected_v<first_set_call, Parser>;
+
+        template<typename Expected, typename AttributeType>
+        struct first_set_impl<
+            char_parser<Expected, AttributeType>,
+            std::enable_if_t<is_nope_v<Expected> || std::is_integral_v<Expected>>>
+        {
+            static constexpr first_set
+            call(char_parser<Expected, AttributeType> const & parser)
+            {
+                if constexpr (is_nope_v<Expected>) {
+                    return first_set::all();
+                } else {
+                    first_set retval;
+                    retval.insert(uint32_t(parser.expected_));
+                    return retval;
+                }
+            }
+        };
+
+        template<typename LoType, typename HiType, typename AttributeType>
+        struct first_set_impl<
+            char_parser<char_pair<LoType, HiType>, AttributeType>,
+            std::enable_if_t<
+                std::is_integral_v<LoType> && std::is_integral_v<HiType>>>
+        {
+            static constexpr first_set call(
+                char_parser<char_pair<LoType, HiType>, AttributeType> const &
+                    parser)
+            {
+                uint32_t const lo = uint32_t(parser.expected_.lo_);
+                uint32_t const hi = uint32_t(parser.expected_.hi_);
+                first_set retval;
+                retval.insert(lo, hi);
+                // Under no_case[], the bounds are folded too.
+                if (detail::is_ascii_letter(lo) || detail::is_ascii_letter(hi))
+                    retval.no_case_exact_ = false;
+                return retval;
+            }
+        };
+
+        template<
+            typename Iter,
+            typename Sentinel,
+            bool SortedUTF32,
+            typename AttributeType>
+        struct first_set_impl<char_parser<
+            char_range<Iter, Sentinel, SortedUTF32>,
+            AttributeType>>
+        {
+            static constexpr first_set call(
+                char_parser<
+                    char_range<Iter, Sentinel, SortedUTF32>,
+                    AttributeType> const & parser)
+            {
+                first_set retval;
+                for (auto c : parser.expected_.chars_) {
+                    retval.insert(uint32_t(c));
+                }
+                return retval;
+            }
+        };
+
+        template<>
+        struct first_set_impl<digit_parser>
+        {
+            static constexpr first_set call(digit_parser const &)
+            {
+                first_set retval;
+                retval.insert(U'0', U'9');
+                return retval;
+            }
+        };
+
+        template<typename Tag>
+        struct first_set_impl<char_set_parser<Tag>>
+        {
+            static constexpr first_set call(char_set_parser<Tag> const &)
+            {
+                first_set retval;
+                // Not all of the char_set<>::chars arrays are sorted.
+                for (uint32_t c : detail::char_set<Tag>::chars) {
+                    if (c < 0x80)
+                        retval.insert(c);
+                }
+                return retval;
+            }
+        };
+
+        template<typename Tag>
+        struct first_set_impl<char_subrange_parser<Tag>>
+        {
+            static constexpr first_set call(char_subrange_parser<Tag> const &)
+            {
+                first_set retval;
+                for (auto subrange : detail::char_subranges<Tag>::ranges) {
+                    retval.insert(subrange.lo_, subrange.hi_);
+                }
+                // char_subrange_parser ignores no_case[].
+                retval.no_case_exact_ = true;
+                return retval;
+            }
+        };
+
+        template<typename StrIter, typename StrSentinel>
+        struct first_set_impl<string_parser<StrIter, StrSentinel>>
+        {
+            static constexpr first_set
+            call(string_parser<StrIter, StrSentinel> const & parser)
+            {
+                if (parser.expected_first_ == parser.expected_last_)
+                    return first_set::all();
+                first_set retval;
+                retval.insert(uint32_t(*parser.expected_first_));
+                return retval;
+            }
+        };
+
+        template<typename Quotes, typename Escapes, bool View>
+        struct first_set_impl<quoted_string_parser<Quotes, Escapes, View>>
+        {
+            static constexpr first_set
+            call(quoted_string_parser<Quotes, Escapes, View> const & parser)
+            {
+                first_set retval;
+                if constexpr (is_nope_v<Quotes>) {
+                    retval.insert(uint32_t(parser.ch_));
+                } else {
+                    for (auto c : parser.chs_) {
+                        retval.insert(uint32_t(c));
+                    }
+                }
+                return retval;
+            }
+        };
+
+        template<bool NewlinesOnly, bool NoNewlines>
+        struct first_set_impl<ws_parser<NewlinesOnly, NoNewlines>>
+        {
+            static constexpr first_set
+            call(ws_parser<NewlinesOnly, NoNewlines> const &)
+            {
+                first_set retval;
+                if constexpr (NewlinesOnly) {
+                    retval.insert(0x0a, 0x0d);
+                } else if constexpr (NoNewlines) {
+                    retval.insert(0x09);
+                    retval.insert(0x20);
+                } else {
+                    retval.insert(0x09, 0x0d);
+                    retval.insert(0x20);
+                }
+                return retval;
+            }
+        };
+
+        template<>
+        struct first_set_impl<bool_parser>
+        {
+            static constexpr first_set call(bool_parser const &)
+            {
+                first_set retval;
+                retval.insert(U't');
+                retval.insert(U'f');
+                return retval;
+            }
+        };
+
+        template<int Radix>
+        constexpr first_set integer_first_set()
+        {
+            first_set retval;
+            retval.insert(U'+');
+            retval.insert(U'-');
+            retval.insert(U'0', U'0' + (Radix < 10 ? Radix : 10) - 1);
+            if (10 < Radix) {
+                retval.insert(U'a', U'a' + Radix - 10 - 1);
+                retval.insert(U'A', U'A' + Radix - 10 - 1);
+            }
+            return retval;
+        }
+
+        template<
+            typename T,
+            int Radix,
+            int MinDigits,
+            int MaxDigits,
+            typename Expected>
+        struct first_set_impl<
+            uint_parser<T, Radix, MinDigits, MaxDigits, Expected>>
+        {
+            static constexpr first_set
+            call(uint_parser<T, Radix, MinDigits, MaxDigits, Expected> const &)
+            {
+                return detail::integer_first_set<Radix>();
+            }
+        };
+
+        template<
+            typename T,
+            int Radix,
+            int MinDigits,
+            int MaxDigits,
+            typename Expected>
+        struct first_set_impl<
+            int_parser<T, Radix, MinDigits, MaxDigits, Expected>>
+        {
+            static constexpr first_set
+            call(int_parser<T, Radix, MinDigits, MaxDigits, Expected> const &)
+            {
+                return detail::integer_first_set<Radix>();
+            }
+        };
+
+        template<typename T, typename Policies>
+        struct first_set_impl<float_parser<T, Policies>>
+        {
+            static constexpr first_set call(float_parser<T, Policies> const &)
+            {
+                first_set retval;
+                if (Policies::allow_plus)
+                    retval.insert(U'+');
+                if (Policies::allow_minus)
+                    retval.insert(U'-');
+                if (Policies::allow_leading_dot)
+                    retval.insert(U'.');
+                retval.insert(U'0', U'9');
+                if (Policies::allow_inf_nan) {
+                    // "inf", "infinity", and "nan", in any case.
+                    retval.insert(U'i');
+                    retval.insert(U'I');
+                    retval.insert(U'n');
+                    retval.insert(U'N');
+                }
+                return retval;
+            }
+        };
+
+        // Parsers that match exactly what their subparser matches.
+        template<typename Parser>
+        struct first_set_of_subparser
+        {
+            template<typename WrappingParser>
+            static constexpr first_set call(WrappingParser const & parser)
+            {
+                return first_set_impl<Parser>::call(parser.parser_);
+            }
+        };
+
+        template<typename Parser, typename Action>
+        struct first_set_impl<
+            action_parser<Parser, Action>,
+            std::enable_if_t<has_first_set_v<Parser>>>
+            : first_set_of_subparser<Parser>
+        {};
+
+        template<typename Parser, typename F>
+        struct first_set_impl<
+            transform_parser<Parser, F>,
+            std::enable_if_t<has_first_set_v<Parser>>>
+            : first_set_of_subparser<Parser>
+        {};
+
+        template<typename Parser>
+        struct first_set_impl<
+            omit_parser<Parser>,
+            std::enable_if_t<has_first_set_v<Parser>>>
+            : first_set_of_subparser<Parser>
+        {};
+
+        template<typename Parser>
+        struct first_set_impl<
+            raw_parser<Parser>,
+            std::enable_if_t<has_first_set_v<Parser>>>
+            : first_set_of_subparser<Parser>
+        {};
+
+#if BOOST_PARSER_USE_CONCEPTS
+        template<typename Parser>
+        struct first_set_impl<
+            string_view_parser<Parser>,
+            std::enable_if_t<has_first_set_v<Parser>>>
+            : first_set_of_subparser<Parser>
+        {};
+#endif
+
+        template<typename Parser>
+        struct first_set_impl<
+            lexeme_parser<Parser>,
+            std::enable_if_t<has_first_set_v<Parser>>>
+            : first_set_of_subparser<Parser>
+        {};
+
+        template<typename Parser>
+        struct first_set_impl<
+            memoize_parser<Parser>,
+            std::enable_if_t<has_first_set_v<Parser>>>
+            : first_set_of_subparser<Parser>
+        {};
+
+        template<typename Parser>
+        struct first_set_impl<
+            no_case_parser<Parser>,
+            std::enable_if_t<has_first_set_v<Parser>>>
+        {
+            static constexpr first_set
+            call(no_case_parser<Parser> const & parser)
+            {
+                first_set const set =
+                    first_set_impl<Parser>::call(parser.parser_);
+                if (!set.no_case_exact_)
+                    return first_set::all();
+                first_set retval;
+                for (uint32_t c = 0; c < 0x80; ++c) {
+                    if (set.contains(c)) {
+                        retval.insert(c);
+                        retval.insert(detail::ascii_other_case(c));
+                    }
+                }
+                return retval;
+            }
+        };
+
+        template<
+            typename Parser,
+            typename... Parsers,
+            typename BacktrackingTuple,
+            typename CombiningGroups>
+        struct first_set_impl<
+            seq_parser<
+                tuple<Parser, Parsers...>,
+                BacktrackingTuple,
+                CombiningGroups>,
+            std::enable_if_t<has_first_set_v<Parser>>>
+        {
+            static constexpr first_set call(
+                seq_parser<
+                    tuple<Parser, Parsers...>,
+                    BacktrackingTuple,
+                    CombiningGroups> const & parser)
+            {
+                return first_set_impl<Parser>::call(
+                    detail::hl::front(parser.parsers_));
+            }
+        };
+
+        template<typename... Parsers>
+        struct first_set_impl<
+            or_parser<tuple<Parsers...>>,
+            std::enable_if_t<(has_first_set_v<Parsers> && ...)>>
+        {
+            static constexpr first_set
+            call(or_parser<tuple<Parsers...>> const & parser)
+            {
+                first_set retval;
+                detail::hl::for_each(
+                    parser.parsers_, [&retval](auto const & subparser) {
+                        first_set const set =
+                            first_set_impl<remove_cv_ref_t<decltype(
+                                subparser)>>::call(subparser);
+                        retval.ascii_[0] |= set.ascii_[0];
+                        retval.ascii_[1] |= set.ascii_[1];
+                        retval.no_case_exact_ &= set.no_case_exact_;
+                    });
+                return retval;
+            }
+        };
+
+        /** A table from each ASCII code point to the set of alternatives of
+            an or_parser that may match input starting with that code point,
+            as a bit mask.  Alternatives without a first_set are in every
+            entry.  The table is only built if at least one alternative has a
+            first_set, and there are at most 64 alternatives. */
+        template<typename ParserTuple>
+        constexpr bool use_or_dispatch_table_v = false;
+        template<typename... Parsers>
+        constexpr bool use_or_dispatch_table_v<tuple<Parsers...>> =
+            sizeof...(Parsers) <= 64 && (has_first_set_v<Parsers> || ...);
+
+        template<
+            typename ParserTuple,
+            bool Enable = use_or_dispatch_table_v<ParserTuple>>
+        struct or_dispatch_table
+        {
+            using mask_t = bool;
+
+            constexpr or_dispatch_table(ParserTuple const &) {}
+
+            template<
+                typename Iter,
+                typename Sentinel,
+                typename Context,
+                typename SkipParser>
+            constexpr mask_t candidates(
+                Iter, Sentinel, Context const &, SkipParser const &, flags)
+                const
+            {
+                return true;
+            }
+
+            static constexpr bool is_candidate(mask_t, int) { return true; }
+        };
+
+        template<typename ParserTuple>
+        struct or_dispatch_table<ParserTuple, true>
+        {
+            static constexpr int size = hl::tuplesize<ParserTuple>::value;
+
+            using mask_t = std::conditional_t<
+                size <= 8,
+                uint8_t,
+                std::conditional_t<
+                    size <= 16,
+                    uint16_t,
+                    std::conditional_t<size <= 32, uint32_t, uint64_t>>>;
+
+            constexpr or_dispatch_table(ParserTuple const & parsers)
+            {
+                int i = 0;
+                hl::for_each(parsers, [this, &i](auto const & parser) {
+                    using parser_t = remove_cv_ref_t<decltype(parser)>;
+                    first_set set = first_set::all();
+                    if constexpr (has_first_set_v<parser_t>)
+                        set = first_set_impl<parser_t>::call(parser);
+                    mask_t const bit = mask_t(1) << i++;
+                    for (uint32_t c = 0; c < 0x80; ++c) {
+                        if (set.contains(c))
+                            table_[c] |= bit;
+                    }
+                    if (!set.no_case_exact_)
+                        no_case_inexact_ |= bit;
+                });
+            }
+
+            // Returns the alternatives that may match at first, after
+            // skipping.
+            template<
+                typename Iter,
+                typename Sentinel,
+                typename Context,
+                typename SkipParser>
+            mask_t candidates(
+                Iter first,
+                Sentinel last,
+                Context const & context,
+                SkipParser const & skip,
+                flags flags) const
+            {
+                using char_type = remove_cv_ref_t<decltype(*first)>;
+                constexpr mask_t all = mask_t(~mask_t(0));
+                if constexpr (!std::is_integral_v<char_type>) {
+                    return all;
+                } else {
+                    // Tracing shows every alternative tried, so try them all.
+                    if (detail::do_trace(flags))
+                        return all;
+                    detail::skip(first, last, skip, flags);
+                    if (first == last)
+                        return all;
+                    uint32_t const cp = (char_type)*first;
+                    if (0x80 <= cp)
+                        return all;
+                    mask_t retval = table_[cp];
+                    if (context.no_case_depth_) {
+                        retval |= table_[detail::ascii_other_case(cp)] |
+                                  no_case_inexact_;
+                    }
+                    return retval;
+                }
+            }
+
+            static constexpr bool is_candidate(mask_t candidates, int i)
+            {
+                return (candidates >> i) & 1;
+            }
+
+            mask_t table_[0x80] = {};
+            mask_t no_case_inexact_ = 0;
+        };
+
+        /** The ASCII code points matched by a parser that always consumes
+            exactly one code point, and that matches an ASCII code point based
+            only on its value.  Used by repeat_parser to consume runs of such
+            code points from contiguous char input in bulk.  The sets are
+            those matched outside of no_case[]. */
+        template<typename Parser, typename Enable = void>
+        struct ascii_class_impl
+        {};
+
+        template<typename Parser>
+        using ascii_class_call = decltype(ascii_class_impl<Parser>::call(
+            std::declval<Parser const &>()));
+
+        template<typename Parser>
+        constexpr bool has_ascii_class_v =
+            is_detected_v<ascii_class_call, Parser>;
+
+        template<typename Expected, typename AttributeType>
+        struct ascii_class_impl<
+            char_parser<Expected, AttributeType>,
+            std::enable_if_t<
+                is_nope_v<Expected> || std::is_integral_v<Expected>>>
+        {
+            static constexpr ascii_bitset
+            call(char_parser<Expected, AttributeType> const & parser)
+            {
+                ascii_bitset retval;
+                if constexpr (is_nope_v<Expected>) {
+                    retval.bits_[0] = ~uint64_t(0);
+                    retval.bits_[1] = ~uint64_t(0);
+                } else if (0 <= parser.expected_ && parser.expected_ < 0x80) {
+                    retval.insert(uint32_t(parser.expected_));
+                }
+                return retval;
+            }
+        };
+
+        template<typename LoType, typename HiType, typename AttributeType>
+        struct ascii_class_impl<
+            char_parser<char_pair<LoType, HiType>, AttributeType>,
+            std::enable_if_t<
+                std::is_integral_v<LoType> && std::is_integral_v<HiType>>>
+        {
+            static constexpr ascii_bitset call(
+                char_parser<char_pair<LoType, HiType>, AttributeType> const &
+                    parser)
+            {
+                ascii_bitset retval;
+                for (int c = 0; c < 0x80; ++c) {
+                    if (parser.expected_.lo_ <= c && c <= parser.expected_.hi_)
+                        retval.insert(c);
+                }
+                return retval;
+            }
+        };
+
+        template<
+            typename Iter,
+            typename Sentinel,
+            bool SortedUTF32,
+            typename AttributeType>
+        struct ascii_class_impl<char_parser<
+            char_range<Iter, Sentinel, SortedUTF32>,
+            AttributeType>>
+        {
+            static constexpr ascii_bitset call(
+                char_parser<
+                    char_range<Iter, Sentinel, SortedUTF32>,
+                    AttributeType> const & parser)
+            {
+                return parser.expected_.ascii_;
+            }
+        };
+
+        template<>
+        struct ascii_class_impl<digit_parser>
+        {
+            static constexpr ascii_bitset call(digit_parser const &)
+            {
+                ascii_bitset retval;
+                for (uint32_t c = U'0'; c <= U'9'; ++c) {
+                    retval.insert(c);
+                }
+                return retval;
+            }
+        };
+
+        template<typename Tag>
+        struct ascii_class_impl<char_set_parser<Tag>>
+        {
+            static constexpr ascii_bitset call(char_set_parser<Tag> const &)
+            {
+                ascii_bitset retval;
+                for (uint32_t c = 0; c < 0x80; ++c) {
+                    if (detail::char_set_table<Tag>::contains(c))
+                        retval.insert(c);
+                }
+                return retval;
+            }
+        };
+
+        template<typename Tag>
+        struct ascii_class_impl<char_subrange_parser<Tag>>
+        {
+            static constexpr ascii_bitset
+            call(char_subrange_parser<Tag> const &)
+            {
+                ascii_bitset retval;
+                for (auto subrange : detail::char_subranges<Tag>::ranges) {
+                    for (uint32_t c = subrange.lo_;
+                         c <= subrange.hi_ && c < 0x80;
+                         ++c) {
+                        retval.insert(c);
+                    }
+                }
+                return retval;
+            }
+        };
+
+        // CR is left out, since ws_parser may match CRLF as one element.
+        template<bool NewlinesOnly, bool NoNewlines>
+        struct ascii_class_impl<ws_parser<NewlinesOnly, NoNewlines>>
+        {
+            static constexpr ascii_bitset
+            call(ws_parser<NewlinesOnly, NoNewlines> const &)
+            {
+                ascii_bitset retval;
+                if constexpr (!NewlinesOnly) {
+                    retval.insert(0x09);
+                    retval.insert(0x20);
+                }
+                if constexpr (!NoNewlines) {
+                    retval.insert(0x0a);
+                    retval.insert(0x0b);
+                    retval.insert(0x0c);
+                }
+                return retval;
+            }
+        };
+
+        template<typename Parser>
+        struct ascii_class_impl<
+            omit_parser<Parser>,
+            std::enable_if_t<has_ascii_class_v<Parser>>>
+        {
+            static constexpr ascii_bitset
+            call(omit_parser<Parser> const & parser)
+            {
+                return ascii_class_impl<Parser>::call(parser.parser_);
+            }
+        };
+
+        /** The ASCII code points at which Parser can begin a match, for use
+            as the b in a - b.  This is Parser's ASCII class, plus CR for the
+            ws parsers, which may match CRLF as one element. */
+        template<typename Parser>
+        struct ascii_match_starts_impl
+        {
+            static constexpr ascii_bitset call(Parser const & parser)
+            {
+                return ascii_class_impl<Parser>::call(parser);
+            }
+        };
+
+        template<bool NewlinesOnly, bool NoNewlines>
+        struct ascii_match_starts_impl<ws_parser<NewlinesOnly, NoNewlines>>
+        {
+            static constexpr ascii_bitset
+            call(ws_parser<NewlinesOnly, NoNewlines> const & parser)
+            {
+                ascii_bitset retval = ascii_class_impl<
+                    ws_parser<NewlinesOnly, NoNewlines>>::call(parser);
+                if constexpr (!NoNewlines)
+                    retval.insert(0x0d);
+                return retval;
+            }
+        };
+
+        template<typename Parser>
+        struct ascii_match_starts_impl<omit_parser<Parser>>
+        {
+            static constexpr ascii_bitset
+            call(omit_parser<Parser> const & parser)
+            {
+                return ascii_match_starts_impl<Parser>::call(parser.parser_);
+            }
+        };
+
+        // For a nested a - b, the starts of a are a superset of its starts.
+        template<
+            typename ExcludedParser,
+            typename Parser,
+            typename CombiningGroups>
+        struct ascii_match_starts_impl<seq_parser<
+            tuple<expect_parser<ExcludedParser, true>, Parser>,
+            tuple<std::true_type, std::true_type>,
+            CombiningGroups>>
+        {
+            static constexpr ascii_bitset call(
+                seq_parser<
+                    tuple<expect_parser<ExcludedParser, true>, Parser>,
+                    tuple<std::true_type, std::true_type>,
+                    CombiningGroups> const & parser)
+            {
+                return ascii_match_starts_impl<Parser>::call(
+                    parser::get(parser.parsers_, llong<1>{}));
+            }
+        };
+
+        // a - b, which is !b >> a.
+        template<
+            typename ExcludedParser,
+            typename Parser,
+            typename CombiningGroups>
+        struct ascii_class_impl<
+            seq_parser<
+                tuple<expect_parser<ExcludedParser, true>, Parser>,
+                tuple<std::true_type, std::true_type>,
+                CombiningGroups>,
+            std::enable_if_t<
+                has_ascii_class_v<ExcludedParser> && has_ascii_class_v<Parser>>>
+        {
+            static constexpr ascii_bitset call(
+                seq_parser<
+                    tuple<expect_parser<ExcludedParser, true>, Parser>,
+                    tuple<std::true_type, std::true_type>,
+                    CombiningGroups> const & parser)
+            {
+                ascii_bitset const excluded =
+                    ascii_match_starts_impl<ExcludedParser>::call(
+                        parser::get(parser.parsers_, llong<0>{}).parser_);
+                ascii_bitset retval = ascii_class_impl<Parser>::call(
+                    parser::get(parser.parsers_, llong<1>{}));
+                retval.bits_[0] &= ~excluded.bits_[0];
+                retval.bits_[1] &= ~excluded.bits_[1];
+                return retval;
+            }
+        };
+
+        /** Finds the length of a run of code units from the ASCII class of
+            Parser, if Parser has one; otherwise empty.  The class is kept
+            as a bitset, and as at most simd::byte_ranges::capacity ranges,
+            which can be checked a vector block at a time. */
+        template<typename Parser, bool Enable = has_ascii_class_v<Parser>>
+        struct ascii_run_finder
+        {
+            constexpr ascii_run_finder(Parser const &) {}
+        };
+
+        template<typename Parser>
+        struct ascii_run_finder<Parser, true>
+        {
+            constexpr ascii_run_finder(Parser const & parser) :
+                class_(ascii_class_impl<Parser>::call(parser))
+            {
+                for (int c = 0; c < 0x80;) {
+                    if (!class_.contains(c)) {
+                        ++c;
+                        continue;
+                    }
+                    int const lo = c;
+                    while (c < 0x80 && class_.contains(c)) {
+                        ++c;
+                    }
+                    if (ranges_.size_ == simd::byte_ranges::capacity) {
+                        use_ranges_ = false;
+                        break;
+                    }
+                    ranges_.lo_[ranges_.size_] = char(lo);
+                    ranges_.hi_[ranges_.size_] = char(c - 1);
+                    ++ranges_.size_;
+                }
+            }
+
+            // Returns the number of elements at the start of [first, first +
+            // n) that are in the class.
+            template<typename Char>
+            std::ptrdiff_t run(Char const * first, std::ptrdiff_t n) const
+            {
+                if constexpr (1 < simd::block_bytes) {
+                    if (use_ranges_) {
+                        return simd::span_in_ranges(
+                            reinterpret_cast<char const *>(first), n, ranges_);
+                    }
+                }
+                std::ptrdiff_t i = 0;
+                for (; i < n; ++i) {
+                    uint32_t const c = (unsigned char)first[i];
+                    if (0x80 <= c || !class_.contains(c))
+                        break;
+                }
+                return i;
+            }
+
+            ascii_bitset class_;
+            simd::byte_ranges ranges_;
+            bool use_ranges_ = true;
+        };
+
+        /** True iff SkipParser, as passed to call() (wrapped in its
+            parser_interface), has an ASCII class. */
+        template<typename SkipParser, typename Enable = void>
+        constexpr bool has_skip_class_v = false;
+
+        template<typename SkipParser>
+        constexpr bool has_skip_class_v<
+            SkipParser,
+            std::enable_if_t<
+                has_ascii_class_v<typename SkipParser::parser_type>>> = true;
+
+        /** Parses one element of a list of numbers from chars, exactly as
+            Parser would, for the numeric parsers whose only state is their
+            type.  Used by repeat_parser to parse delimited lists of numbers
+            in a tight loop. */
+        template<typename Parser>
+        struct number_list_element : std::false_type
+        {};
+
+        template<typename T, typename Policies>
+        struct number_list_element<float_parser<T, Policies>> : std::true_type
+        {
+            using type = T;
+
+            static bool parse(char const *& first, char const * last, T & x)
+            {
+                auto const initial = first;
+                return numeric::parse_real<Policies>(first, last, x) &&
+                       first != initial;
+            }
+        };
+
+        template<typename T, int Radix, int MinDigits, int MaxDigits>
+        struct number_list_element<
+            uint_parser<T, Radix, MinDigits, MaxDigits, nope>> : std::true_type
+        {
+            using type = T;
+
+            static bool parse(char const *& first, char const * last, T & x)
+            {
+                auto const initial = first;
+                return numeric::parse_int<false, Radix, MinDigits, MaxDigits>(
+                           first, last, x) &&
+                       first != initial;
+            }
+        };
+
+        template<typename T, int Radix, int MinDigits, int MaxDigits>
+        struct number_list_element<
+            int_parser<T, Radix, MinDigits, MaxDigits, nope>> : std::true_type
+        {
+            using type = T;
+
+            static bool parse(char const *& first, char const * last, T & x)
+            {
+                auto const initial = first;
+                return numeric::parse_int<true, Radix, MinDigits, MaxDigits>(
+                           first, last, x) &&
+                       first != initial;
+            }
+        };
+
+        /** True iff repeat_parser's Attribute is one that a list of numbers
+            can be appended to directly: a nope, or a container of arithmetic
+            values. */
+        template<typename Attribute>
+        constexpr bool is_number_list_attribute()
+        {
+            if constexpr (is_nope_v<Attribute>)
+                return true;
+            else
+                return std::is_arithmetic_v<range_value_t<Attribute>>;
+        }
+    }
+
+#ifndef BOOST_PARSER_DOXYGEN
+
+    // This constraint is only here to allow the alternate-call semantic
+    // action metaprogramming logic to function on MSVC.
+    template<typename Context>
+    auto _val(Context const & context) -> std::conditional_t<
+        detail::is_nope_v<decltype(*context.val_)>,
+        none,
+        decltype(*context.val_)>
+    {
+        if constexpr (detail::is_nope_v<decltype(*context.val_)>)
+            return none{};
+        else
+            return *context.val_;
+    }
+
+    template<typename Context>
+    decltype(auto) _attr(Context const & context)
+    {
+        if constexpr (detail::is_nope_v<decltype(*context.attr_)>)
+            return none{};
+        else
+            return *context.attr_;
     }
 
     template<typename Context>
@@ -3007,7 +4851,8 @@ namespace boost { namespace parser {
             parser_(parser),
             delimiter_parser_(delimiter_parser),
             min_(_min),
-            max_(_max)
+            max_(_max),
+            run_finder_(parser)
         {}
 
         template<
@@ -3075,8 +4920,12 @@ namespace boost { namespace parser {
 
                 int64_t count = 0;
 
-                for (int64_t end = detail::resolve(context, min_); count != end;
+                for (int64_t end = detail::resolve(context, min_); count < end;
                      ++count) {
+                    count += call_run(
+                        first, last, context, flags, end - count, retval);
+                    if (count == end)
+                        break;
                     detail::skip(first, last, skip, flags);
                     attr_t attr{};
                     parser_.call(
@@ -3096,46 +4945,251 @@ namespace boost { namespace parser {
                 BOOST_PARSER_DEBUG_ASSERT(
                     !detail::is_unconditional_eps<Parser>{} || end < Inf);
 
-                for (; count != end; ++count) {
-                    auto const prev_first = first;
-                    // This is only ever used in delimited_parser, which
-                    // always has a min=1; we therefore know we're after a
-                    // previous element when this executes.
-                    if constexpr (!detail::is_nope_v<DelimiterParser>) {
-                        detail::skip(first, last, skip, flags);
-                        delimiter_parser_.call(
-                            first,
-                            last,
-                            context,
-                            skip,
-                            detail::disable_attrs(flags),
-                            success);
-                        if (!success) {
-                            success = true;
-                            first = prev_first;
-                            break;
-                        }
-                    }
+                for (; count != end; ++count) {
+                    count += call_run(
+                        first,
+                        last,
+                        context,
+                        flags,
+                        end == Inf ? Inf : end - count,
+                        retval);
+                    count += call_numbers(
+                        first,
+                        last,
+                        context,
+                        skip,
+                        flags,
+                        end == Inf ? Inf : end - count,
+                        retval);
+                    if (count == end)
+                        break;
+                    auto const prev_first = first;
+                    // This is only ever used in delimited_parser, which
+                    // always has a min=1; we therefore know we're after a
+                    // previous element when this executes.
+                    if constexpr (!detail::is_nope_v<DelimiterParser>) {
+                        detail::skip(first, last, skip, flags);
+                        delimiter_parser_.call(
+                            first,
+                            last,
+                            context,
+                            skip,
+                            detail::disable_attrs(flags),
+                            success);
+                        if (!success) {
+                            success = true;
+                            first = prev_first;
+                            break;
+                        }
+                    }
+
+                    detail::skip(first, last, skip, flags);
+                    attr_t attr{};
+                    parser_.call(
+                        first, last, context, skip, flags, success, attr);
+                    if (!success) {
+                        success = true;
+                        first = prev_first;
+                        break;
+                    }
+                    detail::move_back(
+                        retval, std::move(attr), detail::gen_attrs(flags));
+                }
+            }
+        }
+
+        // Consumes a run of up to limit elements all at once, if each
+        // element is a single char matched by parser_ based only on its
+        // value, and returns the length of the run.  The run stops before
+        // any non-ASCII char, which is left for parser_ to match.
+        template<
+            typename Iter,
+            typename Sentinel,
+            typename Context,
+            typename Attribute>
+        int64_t call_run(
+            Iter & first,
+            Sentinel last,
+            Context const & context,
+            detail::flags flags,
+            int64_t limit,
+            Attribute & retval) const
+        {
+            if constexpr (
+                detail::has_ascii_class_v<Parser> &&
+                detail::is_nope_v<DelimiterParser> &&
+                std::is_same_v<Iter, Sentinel> &&
+                detail::is_contiguous_char_iter_v<Iter>) {
+                using attr_t = decltype(parser_.call(
+                    first,
+                    last,
+                    context,
+                    detail::null_parser{},
+                    flags,
+                    std::declval<bool &>()));
+                constexpr bool append =
+                    !detail::is_nope_v<attr_t> && !detail::is_nope_v<Attribute>;
+                if constexpr (append) {
+                    if constexpr (!std::is_integral_v<
+                                      detail::range_value_t<Attribute>>)
+                        return 0;
+                    else
+                        return call_run_impl<true>(
+                            first, last, context, flags, limit, retval);
+                } else {
+                    return call_run_impl<false>(
+                        first, last, context, flags, limit, retval);
+                }
+            } else {
+                return 0;
+            }
+        }
+
+        template<
+            bool Append,
+            typename Iter,
+            typename Context,
+            typename Attribute>
+        int64_t call_run_impl(
+            Iter & first,
+            Iter last,
+            Context const & context,
+            detail::flags flags,
+            int64_t limit,
+            Attribute & retval) const
+        {
+            // Skipping between elements, tracing each element, and no_case[]
+            // are left to the general case.
+            if (detail::use_skip(flags) || detail::do_trace(flags) ||
+                context.no_case_depth_ || first == last) {
+                return 0;
+            }
+            std::ptrdiff_t n = last - first;
+            if (limit != Inf && limit < n)
+                n = limit;
+            std::ptrdiff_t const run =
+                run_finder_.run(std::addressof(*first), n);
+            if constexpr (Append) {
+                detail::append(
+                    retval, first, first + run, detail::gen_attrs(flags));
+            }
+            first += run;
+            return run;
+        }
+
+        // Consumes up to limit delimiter-element pairs all at once, if
+        // parser_ is a number parser, the delimiter and the skipper each
+        // match single ASCII chars, and the input is contiguous chars or
+        // UTF-8.  The pairs are parsed straight from the chars, skipping
+        // without calling the skipper, and the number of elements parsed is
+        // returned.  first is left just after the last of them; anything out
+        // of the ordinary after that, like non-ASCII whitespace or the end
+        // of the list, is left to the general case.  Without skipping, the
+        // general case is just as fast.
+        template<
+            typename Iter,
+            typename Sentinel,
+            typename Context,
+            typename SkipParser,
+            typename Attribute>
+        int64_t call_numbers(
+            Iter & first,
+            Sentinel last,
+            Context const & context,
+            SkipParser const & skip,
+            detail::flags flags,
+            int64_t limit,
+            Attribute & retval) const
+        {
+            if constexpr (
+                detail::number_list_element<Parser>::value &&
+                detail::has_ascii_class_v<DelimiterParser> &&
+                detail::has_skip_class_v<SkipParser> &&
+                detail::numeric::unpacks_to_chars<Iter, Sentinel>) {
+                if constexpr (!detail::is_number_list_attribute<Attribute>())
+                    return 0;
+                else
+                    return call_numbers_impl(
+                        first, last, context, skip, flags, limit, retval);
+            } else {
+                return 0;
+            }
+        }
+
+        template<
+            typename Iter,
+            typename Sentinel,
+            typename Context,
+            typename SkipParser,
+            typename Attribute>
+        int64_t call_numbers_impl(
+            Iter & first,
+            Sentinel last,
+            Context const & context,
+            SkipParser const & skip,
+            detail::flags flags,
+            int64_t limit,
+            Attribute & retval) const
+        {
+            using number_t = typename detail::number_list_element<Parser>::type;
+            constexpr bool append = !detail::is_nope_v<Attribute>;
+            if (!detail::use_skip(flags) || detail::do_trace(flags) ||
+                context.no_case_depth_ || first == last) {
+                return 0;
+            }
+
+            char buffer[detail::numeric::number_buffer_size];
+            auto const chars =
+                detail::numeric::unpack_to_chars(first, last, buffer);
+
+            detail::ascii_bitset const delimiters =
+                detail::ascii_class_impl<DelimiterParser>::call(
+                    delimiter_parser_);
+            using skip_parser_t = typename SkipParser::parser_type;
+            detail::ascii_bitset const skipped =
+                detail::ascii_class_impl<skip_parser_t>::call(skip.parser_);
+            auto in_class = [](detail::ascii_bitset const & class_, char c) {
+                uint32_t const cp = (unsigned char)c;
+                return cp < 0x80 && class_.contains(cp);
+            };
 
-                    detail::skip(first, last, skip, flags);
-                    attr_t attr{};
-                    parser_.call(
-                        first, last, context, skip, flags, success, attr);
-                    if (!success) {
-                        success = true;
-                        first = prev_first;
-                        break;
+            char const * it = chars.first;
+            char const * const chars_last = chars.last;
+            char const * element_last = it;
+            int64_t count = 0;
+            while (count != limit) {
+                while (it != chars_last && in_class(skipped, *it)) {
+                    ++it;
+                }
+                if (it == chars_last || !in_class(delimiters, *it))
+                    break;
+                ++it;
+                while (it != chars_last && in_class(skipped, *it)) {
+                    ++it;
+                }
+                number_t x = 0;
+                if (!detail::number_list_element<Parser>::parse(
+                        it, chars_last, x)) {
+                    break;
+                }
+                if constexpr (append) {
+                    if (detail::gen_attrs(flags)) {
+                        detail::insert(
+                            retval, detail::range_value_t<Attribute>(x));
                     }
-                    detail::move_back(
-                        retval, std::move(attr), detail::gen_attrs(flags));
                 }
+                element_last = it;
+                ++count;
             }
+            first = chars.repack(element_last);
+            return count;
         }
 
         Parser parser_;
         DelimiterParser delimiter_parser_;
         MinType min_;
         MaxType max_;
+        [[no_unique_address]] detail::ascii_run_finder<Parser> run_finder_;
     };
 #endif
 
@@ -3240,7 +5294,9 @@ namespace boost { namespace parser {
     template<typename ParserTuple>
     struct or_parser
     {
-        constexpr or_parser(ParserTuple parsers) : parsers_(parsers) {}
+        constexpr or_parser(ParserTuple parsers) :
+            parsers_(parsers), dispatch_table_(parsers_)
+        {}
 
 #ifndef BOOST_PARSER_DOXYGEN
 
@@ -3377,14 +5433,22 @@ namespace boost { namespace parser {
             use_parser_t<Iter, Sentinel, Context, SkipParser> const use_parser{
                 first, last, context, skip, flags, success};
 
+            auto const candidates = dispatch_table_.candidates(
+                first, last, context, skip, flags);
+
             bool done = false;
+            int i = 0;
             auto try_parser = [prev_first = first,
                                use_parser,
                                &success,
                                flags,
                                &retval,
-                               &done](auto const & parser) {
-                if (done)
+                               &done,
+                               candidates,
+                               &i](auto const & parser) {
+                bool const candidate =
+                    dispatch_table_t::is_candidate(candidates, i++);
+                if (done || !candidate)
                     return;
                 if (detail::gen_attrs(flags))
                     use_parser(parser, retval);
@@ -3411,6 +5475,13 @@ namespace boost { namespace parser {
 #endif
 
         ParserTuple parsers_;
+
+#ifndef BOOST_PARSER_DOXYGEN
+
+        using dispatch_table_t = detail::or_dispatch_table<ParserTuple>;
+        [[no_unique_address]] dispatch_table_t dispatch_table_;
+
+#endif
     };
 
     template<typename ParserTuple>
@@ -4949,6 +7020,87 @@ namespace boost { namespace parser {
         Parser parser_;
     };
 
+    template<typename Parser>
+    struct memoize_parser
+    {
+        template<
+            typename Iter,
+            typename Sentinel,
+            typename Context,
+            typename SkipParser>
+        auto call(
+            Iter & first,
+            Sentinel last,
+            Context const & context,
+            SkipParser const & skip,
+            detail::flags flags,
+            bool & success) const
+        {
+            [[maybe_unused]] auto _ = detail::scoped_trace(
+                *this, first, last, context, flags, detail::global_nope);
+
+            using attr_t = decltype(parser_.call(
+                first, last, context, skip, flags, success));
+            if constexpr (!std::is_same_v<
+                              Iter,
+                              std::remove_const_t<decltype(context.first_)>>) {
+                return parser_.call(first, last, context, skip, flags, success);
+            } else {
+                static_assert(
+                    std::is_copy_constructible_v<attr_t>,
+                    "memoize[] only works with parsers whose attributes are "
+                    "copyable, since each memoized result may be used more "
+                    "than once.");
+                auto & table =
+                    detail::get_memo_table<Iter, attr_t>(context, parser_);
+                detail::memo_key const key{
+                    detail::memo_position(context.first_, first),
+                    flags,
+                    context.no_case_depth_,
+                    std::addressof(skip)};
+                auto it = table.find(key);
+                if (it == table.end()) {
+                    attr_t attr =
+                        parser_.call(first, last, context, skip, flags, success);
+                    it = table
+                             .emplace(
+                                 key,
+                                 detail::memo_result<Iter, attr_t>{
+                                     first, success, std::move(attr)})
+                             .first;
+                    return it->second.attr_;
+                }
+                first = it->second.end_;
+                success = it->second.success_;
+                return it->second.attr_;
+            }
+        }
+
+        template<
+            typename Iter,
+            typename Sentinel,
+            typename Context,
+            typename SkipParser,
+            typename Attribute>
+        void call(
+            Iter & first,
+            Sentinel last,
+            Context const & context,
+            SkipParser const & skip,
+            detail::flags flags,
+            bool & success,
+            Attribute & retval) const
+        {
+            auto attr = call(first, last, context, skip, flags, success);
+            if constexpr (!detail::is_nope_v<decltype(attr)>) {
+                if (success)
+                    detail::assign(retval, std::move(attr));
+            }
+        }
+
+        Parser parser_;
+    };
+
     template<typename Parser, typename SkipParser>
     struct skip_parser
     {
@@ -5085,7 +7237,9 @@ namespace boost { namespace parser {
             initial_elements_(std::move(other.initial_elements_)),
             copied_from_(other.copied_from_),
             diagnostic_text_(other.diagnostic_text_)
-        {}
+        {
+            other.trie_cache_.invalidate();
+        }
 
         /** Inserts an entry consisting of a UTF-8 string `str` to match, and
             an associated attribute `x`, to `*this`.  The entry is added for
@@ -5137,7 +7291,7 @@ namespace boost { namespace parser {
         parser::detail::text::optional_ref<T>
         find(Context const & context, std::string_view str) const
         {
-            auto [trie, has_case_folded] = detail::get_trie(context, ref());
+            auto & trie = detail::get_mutable_trie(context, ref());
             if (context.no_case_depth_) {
                 return trie[detail::case_fold_view(
                     str | detail::text::as_utf32)];
@@ -5152,7 +7306,7 @@ namespace boost { namespace parser {
         template<typename Context>
         void insert(Context const & context, std::string_view str, T && x) const
         {
-            auto [trie, has_case_folded] = detail::get_trie(context, ref());
+            auto & trie = detail::get_mutable_trie(context, ref());
             if (context.no_case_depth_) {
                 trie.insert(
                     detail::case_fold_view(str | detail::text::as_utf32),
@@ -5167,7 +7321,7 @@ namespace boost { namespace parser {
         template<typename Context>
         void erase(Context const & context, std::string_view str) const
         {
-            auto [trie, has_case_folded] = detail::get_trie(context, ref());
+            auto & trie = detail::get_mutable_trie(context, ref());
             if (context.no_case_depth_) {
                 trie.erase(
                     detail::case_fold_view(str | detail::text::as_utf32));
@@ -5181,7 +7335,7 @@ namespace boost { namespace parser {
         template<typename Context>
         void clear(Context const & context) const
         {
-            auto [trie, _] = detail::get_trie(context, ref());
+            auto & trie = detail::get_mutable_trie(context, ref());
             trie.clear();
         }
 
@@ -5221,20 +7375,44 @@ namespace boost { namespace parser {
             [[maybe_unused]] auto _ = detail::scoped_trace(
                 *this, first, last, context, flags, retval);
 
-            auto [trie, _0] = detail::get_trie(context, ref());
-            auto const lookup = context.no_case_depth_
-                                    ? trie.longest_match(detail::case_fold_view(
-                                          BOOST_PARSER_SUBRANGE(first, last)))
-                                    : trie.longest_match(first, last);
-            if (lookup.match) {
-                std::advance(first, lookup.size);
-                detail::assign(retval, T{*trie[lookup]});
-            } else {
-                success = false;
+            auto & table = detail::get_symbol_table_trie(context, ref());
+            if constexpr (detail::is_utf8_to_utf32_iter<Iter>::value) {
+                // Walk the underlying UTF-8 code units directly, instead of
+                // decoding the input one code point at a time.
+                auto const * utf8_trie = table.utf8();
+                if (utf8_trie && !context.no_case_depth_) {
+                    auto unpacked =
+                        detail::text::unpack_iterator_and_sentinel(first, last);
+                    auto const lookup = utf8_trie->longest_match(
+                        unpacked.first, unpacked.last);
+                    if (lookup.match) {
+                        first = unpacked.repack(
+                            std::next(unpacked.first, lookup.size));
+                        detail::assign(retval, T{*(*utf8_trie)[lookup]});
+                    } else {
+                        success = false;
+                    }
+                    return;
+                }
             }
+
+            table.visit([&](auto const & trie) {
+                auto const lookup =
+                    context.no_case_depth_
+                        ? trie.longest_match(detail::case_fold_view(
+                              BOOST_PARSER_SUBRANGE(first, last)))
+                        : trie.longest_match(first, last);
+                if (lookup.match) {
+                    std::advance(first, lookup.size);
+                    detail::assign(retval, T{*trie[lookup]});
+                } else {
+                    success = false;
+                }
+            });
         }
 
         mutable std::vector<std::pair<std::string, T>> initial_elements_;
+        detail::symbol_trie_cache<T> trie_cache_;
         symbol_parser const * copied_from_;
 
         symbol_parser const & ref() const noexcept
@@ -5830,6 +8008,7 @@ namespace boost { namespace parser {
         {
             this->parser_.initial_elements_.push_back(
                 std::pair(std::string(str), std::move(x)));
+            this->parser_.trie_cache_.invalidate();
         }
 
         /** Erases the entry whose UTF-8 match string is `str`, from `*this`.
@@ -5842,12 +8021,19 @@ namespace boost { namespace parser {
                 this->parser_.initial_elements_.begin(),
                 this->parser_.initial_elements_.end(),
                 [str](auto const & x) { return x.first == str; });
+            if (it == this->parser_.initial_elements_.end())
+                return;
             this->parser_.initial_elements_.erase(it);
+            this->parser_.trie_cache_.invalidate();
         }
 
         /** Erases all the entries from the copy of the symbol table inside
             the parse context `context`. */
-        void clear_for_next_parse() { this->parser_.initial_elements_.clear(); }
+        void clear_for_next_parse()
+        {
+            this->parser_.initial_elements_.clear();
+            this->parser_.trie_cache_.invalidate();
+        }
 
         /** Inserts an entry consisting of a UTF-8 string `str` to match, and
             an associated attribute `x`, to `*this`.  The entry is added for
@@ -6267,6 +8453,12 @@ namespace boost { namespace parser {
         `parser_interface<P>`. */
     inline constexpr directive<no_case_parser> no_case;
 
+    /** The `memoize` directive, whose `operator[]` returns a
+        `parser_interface<memoize_parser<P>>` from a given parser of type
+        `parser_interface<P>`.  All the `memoize[]` uses of a rule without
+        parameters share their memoized results. */
+    inline constexpr directive<memoize_parser> memoize;
+
     /** Represents a `repeat_parser` as a directive
         (e.g. `repeat[other_parser]`). */
     template<typename MinType, typename MaxType>
@@ -6925,18 +9117,7 @@ namespace boost { namespace parser {
     template<typename Tag>
     struct char_set_parser
     {
-        BOOST_PARSER_ALGO_CONSTEXPR char_set_parser()
-        {
-            auto const & chars = detail::char_set<Tag>::chars;
-            auto const first = std::begin(chars);
-            auto const last = std::end(chars);
-            auto it = std::upper_bound(first, last, 0x100, [](auto x, auto y){
-                using common_t = std::common_type_t<decltype(x), decltype(x)>;
-                return (common_t)x < (common_t)y;
-            });
-            if (it != last)
-                one_byte_offset_ = int(it - first);
-        }
+        constexpr char_set_parser() {}
 
         template<typename T>
         using attribute_type = std::decay_t<T>;
@@ -6982,35 +9163,15 @@ namespace boost { namespace parser {
                 return;
             }
 
-            auto const & chars = detail::char_set<Tag>::chars;
             attribute_type<decltype(*first)> const x = *first;
             uint32_t const x_cmp = x;
-            if (x_cmp < U'\x0100') {
-                uint32_t const * it = std::lower_bound(
-                    std::begin(chars),
-                    std::begin(chars) + one_byte_offset_,
-                    x_cmp);
-                if (it != std::end(chars) && *it == x_cmp) {
-                    detail::assign(retval, x_cmp);
-                    ++first;
-                } else {
-                    success = false;
-                }
-                return;
-            }
-
-            uint32_t const * it = std::lower_bound(
-                std::begin(chars) + one_byte_offset_, std::end(chars), x_cmp);
-            if (it != std::end(chars) && *it == x_cmp) {
-                detail::assign(retval, x_cmp);
-                ++first;
+            if (!detail::char_set_table<Tag>::contains(x_cmp)) {
+                success = false;
                 return;
             }
-
-            success = false;
+            detail::assign(retval, x_cmp);
+            ++first;
         }
-
-        int one_byte_offset_ = 0;
     };
 
     template<typename Tag>
@@ -7252,7 +9413,76 @@ namespace boost { namespace parser {
         return parser_interface{string_parser(str)};
     }
 
-    template<typename Quotes, typename Escapes>
+    /** The attribute produced by `quoted_string_view`.  It refers to the
+        characters between the quotation marks in the input when the quoted
+        string contains no escapes, and owns the unescaped string otherwise.
+        In the former case, it is only valid as long as the input is. */
+    struct maybe_owned_string
+    {
+        maybe_owned_string() = default;
+        explicit maybe_owned_string(std::string_view sv) : view_(sv) {}
+        explicit maybe_owned_string(std::string s) :
+            str_(std::move(s)), owned_(true)
+        {}
+
+        /** Returns true iff `*this` owns its characters, rather than
+            referring to the input. */
+        bool owned() const noexcept { return owned_; }
+
+        std::string_view view() const noexcept
+        {
+            return owned_ ? std::string_view(str_) : view_;
+        }
+        operator std::string_view() const noexcept { return view(); }
+
+        std::string str() const { return std::string(view()); }
+
+        friend bool operator==(
+            maybe_owned_string const & lhs,
+            maybe_owned_string const & rhs) noexcept
+        {
+            return lhs.view() == rhs.view();
+        }
+        friend bool
+        operator==(maybe_owned_string const & lhs, std::string_view rhs) noexcept
+        {
+            return lhs.view() == rhs;
+        }
+        friend bool
+        operator==(std::string_view lhs, maybe_owned_string const & rhs) noexcept
+        {
+            return lhs == rhs.view();
+        }
+        friend bool operator!=(
+            maybe_owned_string const & lhs,
+            maybe_owned_string const & rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+        friend bool
+        operator!=(maybe_owned_string const & lhs, std::string_view rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+        friend bool
+        operator!=(std::string_view lhs, maybe_owned_string const & rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        friend std::ostream &
+        operator<<(std::ostream & os, maybe_owned_string const & s)
+        {
+            return os << s.view();
+        }
+
+    private:
+        std::string_view view_;
+        std::string str_;
+        bool owned_ = false;
+    };
+
+    template<typename Quotes, typename Escapes, bool View>
     struct quoted_string_parser
     {
         constexpr quoted_string_parser() : chs_(), ch_('"') {}
@@ -7295,7 +9525,7 @@ namespace boost { namespace parser {
             typename Sentinel,
             typename Context,
             typename SkipParser>
-        std::string call(
+        auto call(
             Iter & first,
             Sentinel last,
             Context const & context,
@@ -7303,7 +9533,7 @@ namespace boost { namespace parser {
             detail::flags flags,
             bool & success) const
         {
-            std::string retval;
+            std::conditional_t<View, maybe_owned_string, std::string> retval;
             call(first, last, context, skip, flags, success, retval);
             return retval;
         }
@@ -7326,6 +9556,89 @@ namespace boost { namespace parser {
             [[maybe_unused]] auto _ = detail::scoped_trace(
                 *this, first, last, context, flags, retval);
 
+            if constexpr (View) {
+                call_view(first, last, context, skip, flags, success, retval);
+            } else {
+                call_string(
+                    first, last, context, skip, flags, success, retval);
+            }
+        }
+
+        template<
+            typename Iter,
+            typename Sentinel,
+            typename Context,
+            typename SkipParser,
+            typename Attribute>
+        void call_view(
+            Iter & first,
+            Sentinel last,
+            Context const & context,
+            SkipParser const & skip,
+            detail::flags flags,
+            bool & success,
+            Attribute & retval) const
+        {
+            // If the closing quote comes before any backslash, the contents
+            // are referred to in place.  Otherwise, the string is parsed
+            // again from the opening quote, unescaping into an owned copy.
+            if constexpr (
+                std::is_same_v<Iter, Sentinel> &&
+                detail::is_contiguous_char_iter_v<Iter>) {
+                if (first != last && !context.no_case_depth_) {
+                    std::string_view const rest(
+                        reinterpret_cast<char const *>(std::addressof(*first)),
+                        last - first);
+                    char const quote = rest[0];
+                    bool opening_quote = false;
+                    if ((unsigned char)quote < 0x80) {
+                        if constexpr (detail::is_nope_v<Quotes>) {
+                            opening_quote = (char32_t)quote == ch_;
+                        } else {
+                            opening_quote =
+                                detail::text::find(
+                                    chs_.begin(), chs_.end(), quote) !=
+                                chs_.end();
+                        }
+                    }
+                    if (opening_quote) {
+                        std::ptrdiff_t const n = detail::simd::find_either(
+                            rest.data() + 1, rest.size() - 1, quote, '\\');
+                        if (n + 1 < (std::ptrdiff_t)rest.size() &&
+                            rest[n + 1] == quote) {
+                            if (detail::gen_attrs(flags)) {
+                                detail::assign(
+                                    retval,
+                                    maybe_owned_string(rest.substr(1, n)));
+                            }
+                            first += n + 2;
+                            return;
+                        }
+                    }
+                }
+            }
+
+            std::string str;
+            call_string(first, last, context, skip, flags, success, str);
+            if (success && detail::gen_attrs(flags))
+                detail::assign(retval, maybe_owned_string(std::move(str)));
+        }
+
+        template<
+            typename Iter,
+            typename Sentinel,
+            typename Context,
+            typename SkipParser,
+            typename Attribute>
+        void call_string(
+            Iter & first,
+            Sentinel last,
+            Context const & context,
+            SkipParser const & skip,
+            detail::flags flags,
+            bool & success,
+            Attribute & retval) const
+        {
             if (first == last) {
                 success = false;
                 return;
@@ -7370,6 +9683,59 @@ namespace boost { namespace parser {
             if (!success)
                 return;
 
+            // On contiguous char input, whole spans between backslashes are
+            // appended at once.  At anything but the closing quote or an
+            // escape, the rest of the string is left to the parser below,
+            // which reports any error.
+            if constexpr (
+                std::is_same_v<Iter, Sentinel> &&
+                detail::is_contiguous_char_iter_v<Iter>) {
+                if (!detail::do_trace(flags) && !context.no_case_depth_ &&
+                    uint32_t(ch) < 0x80) {
+                    auto const gen_attrs = detail::gen_attrs(flags);
+                    char const quote = char(ch);
+                    while (first != last) {
+                        auto const span_last =
+                            first + detail::simd::find_either(
+                                        reinterpret_cast<char const *>(
+                                            std::addressof(*first)),
+                                        last - first,
+                                        quote,
+                                        '\\');
+                        detail::append(retval, first, span_last, gen_attrs);
+                        first = span_last;
+                        if (first == last)
+                            break;
+                        if (*first == quote) {
+                            ++first;
+                            return;
+                        }
+                        auto const next = std::next(first);
+                        if (next != last && (*next == '\\' || *next == quote)) {
+                            auto c = *next;
+                            detail::move_back(retval, std::move(c), gen_attrs);
+                            first = std::next(next);
+                            continue;
+                        }
+                        if constexpr (!detail::is_nope_v<Escapes>) {
+                            auto const escape =
+                                (lit('\\') >> parser_interface(escapes_))[append];
+                            escape.parser_.call(
+                                first,
+                                last,
+                                context,
+                                skip,
+                                detail::disable_skip(flags),
+                                success);
+                            if (success)
+                                continue;
+                            success = true;
+                        }
+                        break;
+                    }
+                }
+            }
+
             decltype(ch) const backslash_and_delim[] = {'\\', ch};
             auto const back_delim = char_(backslash_and_delim);
 
@@ -7419,7 +9785,9 @@ namespace boost { namespace parser {
                      "quoted_string, like 'quoted_string('\"')('\\'')'.  Quit "
                      "it!'"));
             }
-            return parser_interface(quoted_string_parser(std::move(x)));
+            return parser_interface(
+                quoted_string_parser<detail::nope, detail::nope, View>(
+                    std::move(x)));
         }
 
         /** Returns a `parser_interface` containing a `quoted_string_parser`
@@ -7453,8 +9821,11 @@ namespace boost { namespace parser {
                      "'quoted_string(char-range)(char-range)'.  Quit it!'"));
             }
             return parser_interface(
-                quoted_string_parser<decltype(BOOST_PARSER_SUBRANGE(
-                    detail::make_view_begin(r), detail::make_view_end(r)))>(
+                quoted_string_parser<
+                    decltype(BOOST_PARSER_SUBRANGE(
+                        detail::make_view_begin(r), detail::make_view_end(r))),
+                    detail::nope,
+                    View>(
                     BOOST_PARSER_SUBRANGE(
                         detail::make_view_begin(r), detail::make_view_end(r))));
         }
@@ -7484,8 +9855,9 @@ namespace boost { namespace parser {
                      "it!'"));
             }
             auto symbols = symbol_parser(escapes.parser_);
-            auto parser = quoted_string_parser<detail::nope, decltype(symbols)>(
-                char32_t(x), symbols);
+            auto parser =
+                quoted_string_parser<detail::nope, decltype(symbols), View>(
+                    char32_t(x), symbols);
             return parser_interface(parser);
         }
 
@@ -7527,8 +9899,10 @@ namespace boost { namespace parser {
             auto quotes = BOOST_PARSER_SUBRANGE(
                 detail::make_view_begin(r), detail::make_view_end(r));
             auto parser =
-                quoted_string_parser<decltype(quotes), decltype(symbols)>(
-                    quotes, symbols);
+                quoted_string_parser<
+                    decltype(quotes),
+                    decltype(symbols),
+                    View>(quotes, symbols);
             return parser_interface(parser);
         }
 
@@ -7558,6 +9932,14 @@ namespace boost { namespace parser {
         quotation mark.  Produces a `std::string` attribute. */
     inline constexpr parser_interface<quoted_string_parser<>> quoted_string;
 
+    /** Like `quoted_string`, except that it produces a `maybe_owned_string`
+        attribute.  When the input is a contiguous sequence of `char` and the
+        quoted string contains no escapes, the attribute refers to the input
+        directly, and no allocation is made. */
+    inline constexpr parser_interface<
+        quoted_string_parser<detail::nope, detail::nope, true>>
+        quoted_string_view;
+
     /** Returns a parser that matches `str` that produces no attribute. */
 #if BOOST_PARSER_USE_CONCEPTS
     template<parsable_range_like R>
@@ -7719,21 +10101,18 @@ namespace boost { namespace parser {
     /** The punctuation character parser.  Matches the full set of Unicode
         punctuation clases (specifically, "Pc", "Pd", "Pe", "Pf", "Pi", "Ps",
         and "Po"). */
-    inline BOOST_PARSER_ALGO_CONSTEXPR
-        parser_interface<char_set_parser<detail::punct_chars>>
-            punct;
+    inline constexpr parser_interface<char_set_parser<detail::punct_chars>>
+        punct;
 
     /** The lower case character parser.  Matches the full set of Unicode
         lower case code points (class "Ll"). */
-    inline BOOST_PARSER_ALGO_CONSTEXPR
-        parser_interface<char_set_parser<detail::lower_case_chars>>
-            lower;
+    inline constexpr parser_interface<char_set_parser<detail::lower_case_chars>>
+        lower;
 
     /** The lower case character parser.  Matches the full set of Unicode
         lower case code points (class "Lu"). */
-    inline BOOST_PARSER_ALGO_CONSTEXPR
-        parser_interface<char_set_parser<detail::upper_case_chars>>
-            upper;
+    inline constexpr parser_interface<char_set_parser<detail::upper_case_chars>>
+        upper;
 
 #ifndef BOOST_PARSER_DOXYGEN
 
@@ -8019,9 +10398,14 @@ namespace boost { namespace parser {
 
 #ifndef BOOST_PARSER_DOXYGEN
 
-    template<typename T>
+    template<typename T, typename Policies>
     struct float_parser
     {
+        static_assert(
+            std::is_same_v<Policies, float_policies> ||
+                detail::numeric::is_decimal_float<T>,
+            "Only float and double support custom float_policies.");
+
         constexpr float_parser() {}
 
         template<
@@ -8061,7 +10445,8 @@ namespace boost { namespace parser {
                 *this, first, last, context, flags, retval);
             T attr = 0;
             auto const initial = first;
-            success = detail::numeric::parse_real(first, last, attr);
+            success =
+                detail::numeric::parse_real<Policies>(first, last, attr);
             if (first == initial)
                 success = false;
             if (success)
@@ -8077,6 +10462,26 @@ namespace boost { namespace parser {
     /** The `double` parser.  Produces a `double` attribute. */
     inline constexpr parser_interface<float_parser<double>> double_;
 
+    /** The JSON number parser.  Matches the number syntax of JSON (see
+        `json_number_policies`), and produces a `double` attribute. */
+    inline constexpr parser_interface<
+        float_parser<double, json_number_policies>>
+        json_number;
+
+    /** The plain decimal number parser.  Matches numbers like "-12.50",
+        without exponents (see `strict_decimal_policies`), and produces a
+        `double` attribute. */
+    inline constexpr parser_interface<
+        float_parser<double, strict_decimal_policies>>
+        strict_decimal;
+
+    /** The C floating-point literal parser.  Matches the syntax of a
+        decimal floating-point literal in C23 or C++14 source, without the
+        suffix (see `c_literal_policies`), and produces a `double`
+        attribute.  Integer literals like "42" are not matched. */
+    inline constexpr parser_interface<float_parser<double, c_literal_policies>>
+        c_literal;
+
 
     /** Represents a sequence parser, the first parser of which is an
         `epsilon_parser` with predicate, as a directive
@@ -9330,6 +11735,72 @@ namespace boost { namespace parser {
                 first, last, parser, skip, callbacks, trace_mode));
     }
 
+    /** Reusable storage for the bookkeeping a parse needs: the parse's views
+        of the symbol tables it uses, the symbol table operations it defers
+        to the end of the parse, and its memoization tables.  Each call to
+        `parse()`, `prefix_parse()`, etc. normally sets up and tears down its
+        own; a parse made through a `parse_session` uses the session's
+        instead, and leaves them to the session's next parse.  This matters
+        most when making many short parses with a parser that uses symbol
+        tables, since a symbol table's view can then be kept from one parse
+        to the next, rather than being looked up and allocated again.
+
+        Each parse through a session starts from the same state that a parse
+        without one would.  A `parse_session` must not be used by more than
+        one thread at a time. */
+    struct parse_session
+    {
+        parse_session() = default;
+        parse_session(parse_session const &) = delete;
+        parse_session & operator=(parse_session const &) = delete;
+
+        /** Returns `parser::parse(args...)`, using `*this`. */
+        template<typename... Args>
+        decltype(auto) parse(Args &&... args)
+        {
+            scoped_activation activation(tables_);
+            return parser::parse((Args &&) args...);
+        }
+
+        /** Returns `parser::prefix_parse(args...)`, using `*this`. */
+        template<typename... Args>
+        decltype(auto) prefix_parse(Args &&... args)
+        {
+            scoped_activation activation(tables_);
+            return parser::prefix_parse((Args &&) args...);
+        }
+
+        /** Returns `parser::callback_parse(args...)`, using `*this`. */
+        template<typename... Args>
+        decltype(auto) callback_parse(Args &&... args)
+        {
+            scoped_activation activation(tables_);
+            return parser::callback_parse((Args &&) args...);
+        }
+
+        /** Returns `parser::callback_prefix_parse(args...)`, using
+            `*this`. */
+        template<typename... Args>
+        decltype(auto) callback_prefix_parse(Args &&... args)
+        {
+            scoped_activation activation(tables_);
+            return parser::callback_prefix_parse((Args &&) args...);
+        }
+
+    private:
+        struct scoped_activation
+        {
+            scoped_activation(detail::parse_tables & tables) :
+                prev_(std::exchange(detail::session_parse_tables(), &tables))
+            {}
+            ~scoped_activation() { detail::session_parse_tables() = prev_; }
+
+            detail::parse_tables * prev_;
+        };
+
+        detail::parse_tables tables_;
+    };
+
     namespace literals {
         /** Returns a literal parser equivalent to `lit(c)`. */
         constexpr auto operator""_l(char c) { return parser::lit(c); }
@@ -9403,7 +11874,8 @@ namespace boost { namespace parser {
                 std::declval<error_handler_type>(),
                 std::declval<global_state_type &>(),
                 std::declval<detail::symbol_table_tries_t &>(),
-                std::declval<detail::pending_symbol_table_operations_t &>()));
+                std::declval<detail::pending_symbol_table_operations_t &>(),
+                std::declval<detail::memo_tables_t &>()));
             using type = decltype(std::declval<Parser>()(
                 std::declval<iterator &>(),
                 std::declval<sentinel>(),
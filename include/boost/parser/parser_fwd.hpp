@@ -85,6 +85,8 @@ namespace boost { namespace parser {
         {
             std::any trie_;
             bool has_case_folded_;
+            // Set when a parse_session reuses this element in a later parse.
+            bool from_earlier_parse_ = false;
         };
 
         using symbol_table_tries_t =
@@ -103,6 +105,14 @@ namespace boost { namespace parser {
             pending_symtab_ops_entry,
             std::less<void const *>>;
 
+        // Maps a memoized parser and the types it was used with to a
+        // std::map from input position to result (the exact type is known to
+        // memoize_parser).
+        using memo_tables_t = std::map<
+            std::pair<void const *, void const *>,
+            std::any,
+            std::less<std::pair<void const *, void const *>>>;
+
         template<
             bool DoTrace,
             bool UseCallbacks,
@@ -117,8 +127,8 @@ namespace boost { namespace parser {
             ErrorHandler const & error_handler,
             nope &,
             symbol_table_tries_t & symbol_table_tries,
-            pending_symbol_table_operations_t &
-                pending_symbol_table_operations) noexcept;
+            pending_symbol_table_operations_t & pending_symbol_table_operations,
+            memo_tables_t & memo_tables) noexcept;
 
         struct skip_skipper;
 
@@ -279,6 +289,14 @@ namespace boost { namespace parser {
     template<typename Parser>
     struct no_case_parser;
 
+    /** Applies the given parser `p` of type `Parser`, remembering the result
+        of each attempt to parse at a given input position, so that later
+        attempts at the same position reuse that result instead of parsing
+        again.  The parse succeeds iff `p` succeeds.  The attribute produced
+        is the type of attribute produced by `Parser`. */
+    template<typename Parser>
+    struct memoize_parser;
+
     /** Applies the given parser `p` of type `Parser`, using a parser of type
         `SkipParser` as the skipper.  The parse succeeds iff `p` succeeds.
         The attribute produced is the type of attribute produced by
@@ -379,8 +397,12 @@ namespace boost { namespace parser {
     struct string_parser;
 
     /** Matches a string delimited by quotation marks; produces a
-        `std::string` attribute. */
-    template<typename Quotes = detail::nope, typename Escapes = detail::nope>
+        `std::string` attribute, or a `maybe_owned_string` attribute if
+        `View` is `true`. */
+    template<
+        typename Quotes = detail::nope,
+        typename Escapes = detail::nope,
+        bool View = false>
     struct quoted_string_parser;
 
     /** Matches an end-of-line (`NewlinesOnly == true`), whitespace
@@ -423,9 +445,86 @@ namespace boost { namespace parser {
         typename Expected = detail::nope>
     struct int_parser;
 
-    /** Matches a floating point number, producing an attribute of type
-        `T`. */
-    template<typename T>
+    /** The syntax of the numbers matched by `float_parser`.  The defaults
+        accept an optional sign, then decimal digits with an optional
+        decimal point, then an optional exponent; or "inf", "infinity",
+        "nan", or "nan(...)", in any case.  To change one aspect of the
+        syntax, derive from this type and hide the corresponding member. */
+    struct float_policies
+    {
+        /** Whether a leading '+' is allowed. */
+        static constexpr bool allow_plus = true;
+        /** Whether a leading '-' is allowed. */
+        static constexpr bool allow_minus = true;
+        /** Whether "inf", "infinity", "nan" and "nan(...)" are allowed. */
+        static constexpr bool allow_inf_nan = true;
+        /** Whether the decimal point may be the first char, as in ".5". */
+        static constexpr bool allow_leading_dot = true;
+        /** Whether the decimal point may be the last char, as in "5.".
+            If not, a decimal point that is not followed by a digit is not
+            part of the number. */
+        static constexpr bool allow_trailing_dot = true;
+        /** Whether the integer part may have leading zeros, as in "007".  If
+            not, an integer part that starts with '0' ends there. */
+        static constexpr bool allow_leading_zeros = true;
+        /** Whether an exponent, as in "1e10", is allowed. */
+        static constexpr bool allow_exponent = true;
+        /** Whether a decimal point or an exponent is required, so that a
+            plain digit sequence like "42" is not matched. */
+        static constexpr bool require_fraction_or_exponent = false;
+        /** A char that may appear between two digits without affecting the
+            value, as in "1_000_000"; none if `'\0'`. */
+        static constexpr char digit_separator = '\0';
+        /** Whether a number too large for the attribute type produces
+            infinity, and a nonzero number too small for it produces zero
+            (each with the number's sign), as with `strtod()`.  If not, such
+            numbers are not matched. */
+        static constexpr bool allow_out_of_range = false;
+    };
+
+    /** The syntax of a JSON number: an optional '-', an integer part
+        without leading zeros, an optional fraction that has at least one
+        digit, and an optional exponent.  JSON puts no limit on the range
+        of numbers, so out-of-range ones saturate, as they do in most JSON
+        libraries. */
+    struct json_number_policies : float_policies
+    {
+        static constexpr bool allow_plus = false;
+        static constexpr bool allow_inf_nan = false;
+        static constexpr bool allow_leading_dot = false;
+        static constexpr bool allow_trailing_dot = false;
+        static constexpr bool allow_leading_zeros = false;
+        static constexpr bool allow_out_of_range = true;
+    };
+
+    /** Plain decimal notation: an optional sign, then digits, optionally
+        followed by a decimal point and more digits, as in "-12.50". */
+    struct strict_decimal_policies : float_policies
+    {
+        static constexpr bool allow_inf_nan = false;
+        static constexpr bool allow_leading_dot = false;
+        static constexpr bool allow_trailing_dot = false;
+        static constexpr bool allow_exponent = false;
+    };
+
+    /** The syntax of a decimal floating-point literal in C23 or C++14
+        source, without the suffix: no sign, digits that may be separated
+        by '\'', and "1.", ".5" and "1e10" forms.  As in C and C++, a
+        decimal point or an exponent is required; "42" is an integer
+        literal. */
+    struct c_literal_policies : float_policies
+    {
+        static constexpr bool allow_plus = false;
+        static constexpr bool allow_minus = false;
+        static constexpr bool allow_inf_nan = false;
+        static constexpr bool require_fraction_or_exponent = true;
+        static constexpr char digit_separator = '\'';
+    };
+
+    /** Matches a floating point number in the syntax described by
+        `Policies`, producing an attribute of type `T`.  Unless `Policies`
+        is `float_policies`, `T` must be `float` or `double`. */
+    template<typename T, typename Policies = float_policies>
     struct float_parser;
 
     /** Applies at most one of the parsers in `OrParser`.  If `switch_value_`
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2024 T. Zachary Laine
+#
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+# Generates the 128-bit approximations of the powers of five used by the
+# Eisel-Lemire algorithm (see Daniel Lemire, "Number Parsing at a Gigabyte per
+# Second", Software: Practice and Experience 51 (8), 2021).  Each power 5^q is
+# scaled by a power of two so that its most significant bit is bit 127.
+# Positive powers are truncated; negative ones are rounded up.
+
+smallest_power = -342
+largest_power = 308
+
+def approximation(q):
+    if q < 0:
+        power5 = 5 ** -q
+        z = power5.bit_length()
+        if q >= -27:
+            b = z + 127
+            c = 2 ** b // power5 + 1
+        else:
+            b = 2 * z + 2 * 64
+            c = 2 ** b // power5 + 1
+            while c >= (1 << 128):
+                c //= 2
+        return c
+    power5 = 5 ** q
+    while power5 < (1 << 127):
+        power5 *= 2
+    while power5 >= (1 << 128):
+        power5 //= 2
+    return power5
+
+print('''// Copyright (c) 2024 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Warning: This header is auto-generated (see misc/generate_power_of_five_table.py).
+// The lack of include guards is intentional.
+
+namespace boost::parser::detail::numeric {
+''')
+
+print(f'inline constexpr int smallest_power_of_five = {smallest_power};')
+print(f'inline constexpr int largest_power_of_five = {largest_power};')
+n = 2 * (largest_power - smallest_power + 1)
+print(f'inline constexpr std::uint64_t power_of_five_128[{n}] = {{')
+for q in range(smallest_power, largest_power + 1):
+    c = approximation(q)
+    print(f'    0x{c >> 64:016x}, 0x{c & ((1 << 64) - 1):016x}, // 5^{q}')
+print('};')
+
+print('\n}')
@@ -0,0 +1,63 @@
+// Copyright (C) 2024 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/parser/incremental_parse.hpp>
+
+#include "perf.hpp"
+
+#include <string>
+#include <string_view>
+
+
+namespace bp = boost::parser;
+
+// One large message, as it might arrive from a socket.
+std::string make_message(std::size_t size)
+{
+    std::string retval = "[";
+    for (int i = 0; retval.size() < size; ++i) {
+        retval += std::to_string(i % 100000);
+        retval += ',';
+    }
+    retval += "0]";
+    return retval;
+}
+
+int main()
+{
+    std::printf("incremental_parse (%s)\n", perf::simd_config());
+
+    std::string const message = make_message(4 << 20);
+    auto const parser = '[' >> bp::int_ % ',' >> ']';
+
+    perf::run(
+        "parse()",
+        message.size(),
+        [&] {
+            auto const result = bp::parse(message, parser);
+            perf::do_not_optimize(result);
+        },
+        5);
+
+    for (std::size_t chunk_size :
+         {std::size_t(4 << 10), std::size_t(64 << 10)}) {
+        std::string const name =
+            "incremental_parse, " + std::to_string(chunk_size >> 10) +
+            " KiB chunks";
+        perf::run(
+            name.c_str(),
+            message.size(),
+            [&] {
+                bp::incremental_parse session(parser);
+                std::string_view const input = message;
+                for (std::size_t i = 0; i < input.size(); i += chunk_size) {
+                    session.feed(input.substr(i, chunk_size));
+                }
+                session.finish();
+                perf::do_not_optimize(session.result());
+            },
+            5);
+    }
+}
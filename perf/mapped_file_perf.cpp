@@ -0,0 +1,75 @@
+// Copyright (C) 2024 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/parser/mapped_file.hpp>
+#include <boost/parser/parser.hpp>
+
+#include "perf.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace bp = boost::parser;
+
+// About 64MB of comma-separated integers.  The file is written before it is
+// timed, so it is (most likely) in the page cache; this measures the cost of
+// getting the bytes to the parser, not the cost of disk I/O.
+void write_file(char const * path)
+{
+    std::mt19937 g(42);
+    std::string contents;
+    while (contents.size() < 64 * 1024 * 1024) {
+        if (!contents.empty())
+            contents += ',';
+        contents += std::to_string(g() % 1000000);
+    }
+    std::ofstream ofs(path, std::ios_base::binary);
+    ofs << contents;
+}
+
+int main()
+{
+    std::printf("mapped_file (%s)\n", perf::simd_config());
+
+    char const * const path = "mapped_file_perf.txt";
+    write_file(path);
+    std::size_t const bytes = bp::mapped_file(path).size();
+
+    auto const ints = bp::int_ % ',';
+    std::vector<int> result;
+
+    perf::run(
+        "read into std::string, then parse",
+        bytes,
+        [&] {
+            std::ifstream ifs(path, std::ios_base::binary);
+            std::string const contents(
+                (std::istreambuf_iterator<char>(ifs)),
+                std::istreambuf_iterator<char>());
+            result.clear();
+            bool const success = bp::parse(contents, ints, result);
+            perf::do_not_optimize(success);
+            perf::do_not_optimize(result);
+        },
+        5);
+    perf::run(
+        "mapped_file, then parse",
+        bytes,
+        [&] {
+            bp::mapped_file const file(path);
+            result.clear();
+            bool const success = bp::parse(file, ints, result);
+            perf::do_not_optimize(success);
+            perf::do_not_optimize(result);
+        },
+        5);
+
+    std::remove(path);
+}
@@ -0,0 +1,272 @@
+// Copyright (C) 2024 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/parser/parser.hpp>
+
+#include "perf.hpp"
+
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace bp = boost::parser;
+
+// Log-style timestamps, one per line: "2024-10-16 12:34:56.789".
+std::string make_timestamps(int lines)
+{
+    std::mt19937 g(42);
+    std::string retval;
+    char buf[32];
+    for (int i = 0; i < lines; ++i) {
+        std::snprintf(
+            buf,
+            sizeof(buf),
+            "%04u-%02u-%02u %02u:%02u:%02u.%03u\n",
+            2000 + g() % 30,
+            1 + g() % 12,
+            1 + g() % 28,
+            g() % 24,
+            g() % 60,
+            g() % 60,
+            g() % 1000);
+        retval += buf;
+    }
+    return retval;
+}
+
+// JSON-style "\uXXXX" escapes.
+std::string make_escapes(int n)
+{
+    std::mt19937 g(42);
+    std::string retval;
+    char buf[8];
+    for (int i = 0; i < n; ++i) {
+        std::snprintf(buf, sizeof(buf), "\\u%04x", unsigned(g() % 0x10000));
+        retval += buf;
+    }
+    return retval;
+}
+
+// Comma-separated integers and reals, as in a JSON array.
+std::string make_numbers(int n)
+{
+    std::mt19937 g(42);
+    std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+    std::string retval;
+    char buf[32];
+    for (int i = 0; i < n; ++i) {
+        if (i)
+            retval += ',';
+        if (i % 2)
+            std::snprintf(buf, sizeof(buf), "%d", int(g() % 100000));
+        else
+            std::snprintf(buf, sizeof(buf), "%.6g", dist(g));
+        retval += buf;
+    }
+    return retval;
+}
+
+template<typename R>
+void bench_numbers(char const * name, R const & r, std::size_t bytes)
+{
+    perf::run(name, bytes, [&] {
+        std::vector<double> result;
+        bool const success = bp::parse(r, bp::double_ % ',', result);
+        perf::do_not_optimize(success);
+        perf::do_not_optimize(result);
+    });
+}
+
+// A matrix dump: rows of eight comma-separated reals, with a space after
+// each comma and a newline after each row.
+std::string make_matrix(int n)
+{
+    std::mt19937 g(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::string retval;
+    char buf[32];
+    for (int i = 0; i < n; ++i) {
+        if (i)
+            retval += i % 8 ? ", " : ",\n";
+        std::snprintf(buf, sizeof(buf), "%.9f", dist(g));
+        retval += buf;
+    }
+    return retval;
+}
+
+void bench_matrix(char const * name, std::string const & input)
+{
+    perf::run(name, input.size(), [&] {
+        std::vector<double> result;
+        bool const success =
+            bp::parse(input, bp::double_ % ',', bp::ws, result);
+        perf::do_not_optimize(success);
+        perf::do_not_optimize(result);
+    });
+}
+
+// Integers separated by a comma and a space, like the samples in a sensor
+// frame.
+std::string make_integers(int n)
+{
+    std::mt19937 g(42);
+    std::string retval;
+    for (int i = 0; i < n; ++i) {
+        if (i)
+            retval += ", ";
+        retval += std::to_string(int(g() % 200000) - 100000);
+    }
+    return retval;
+}
+
+void bench_integers(char const * name, std::string const & input)
+{
+    perf::run(name, input.size(), [&] {
+        std::vector<int> result;
+        bool const success = bp::parse(input, bp::int_ % ',', bp::ws, result);
+        perf::do_not_optimize(success);
+        perf::do_not_optimize(result);
+    });
+}
+
+// Comma-separated coordinates like those in canada.json: six decimal places
+// of precision, printed with all 17 digits, as "-65.613616999999977".
+std::string make_coordinates(int n)
+{
+    std::mt19937 g(42);
+    std::uniform_real_distribution<double> lon(-141.0, -52.0);
+    std::uniform_real_distribution<double> lat(41.0, 83.0);
+    std::string retval;
+    char buf[32];
+    for (int i = 0; i < n; ++i) {
+        if (i)
+            retval += ',';
+        double const x = i % 2 ? lat(g) : lon(g);
+        std::snprintf(buf, sizeof(buf), "%.17g", std::round(x * 1e6) / 1e6);
+        retval += buf;
+    }
+    return retval;
+}
+
+// Parses the comma-separated numbers in `input` with `parse_one(first,
+// last, x)`, without the rest of Boost.Parser.
+template<typename ParseOne>
+void bench_number_loop(
+    char const * name, std::string const & input, ParseOne parse_one)
+{
+    perf::run(name, input.size(), [&] {
+        std::vector<double> result;
+        char const * first = input.data();
+        char const * const last = first + input.size();
+        double x;
+        while (parse_one(first, last, x)) {
+            result.push_back(x);
+            if (first == last || *first != ',')
+                break;
+            ++first;
+        }
+        perf::do_not_optimize(result);
+    });
+}
+
+bp::parser_interface<bp::uint_parser<unsigned int, 10, 2, 2>> const d2;
+bp::parser_interface<bp::uint_parser<unsigned int, 10, 3, 3>> const d3;
+bp::parser_interface<bp::uint_parser<unsigned int, 10, 4, 4>> const d4;
+bp::parser_interface<bp::uint_parser<unsigned int, 16, 4, 4>> const hex4;
+
+auto const timestamp = d4 >> '-' >> d2 >> '-' >> d2 >> ' ' >> d2 >> ':' >>
+                       d2 >> ':' >> d2 >> '.' >> d3 >> '\n';
+auto const escape = "\\u" >> hex4;
+
+template<typename Parser>
+void bench(char const * name, std::string const & input, Parser parser)
+{
+    perf::run(name, input.size(), [&] {
+        unsigned int sum = 0;
+        auto const add = [&](auto & ctx) {
+            sum += bp::get(_attr(ctx), bp::llong<0>{}) +
+                   bp::get(_attr(ctx), bp::llong<6>{});
+        };
+        bool const success = bp::parse(input, *parser[add]);
+        perf::do_not_optimize(success);
+        perf::do_not_optimize(sum);
+    });
+}
+
+template<typename Parser>
+void bench_escapes(char const * name, std::string const & input, Parser parser)
+{
+    perf::run(name, input.size(), [&] {
+        unsigned int sum = 0;
+        auto const add = [&](auto & ctx) { sum += _attr(ctx); };
+        bool const success = bp::parse(input, *parser[add]);
+        perf::do_not_optimize(success);
+        perf::do_not_optimize(sum);
+    });
+}
+
+int main()
+{
+    std::printf("numeric (%s)\n", perf::simd_config());
+
+    std::string const timestamps = make_timestamps(1000000);
+    bench("timestamps", timestamps, timestamp);
+
+    std::string const escapes = make_escapes(1000000);
+    bench_escapes("\\uXXXX escapes", escapes, escape);
+
+    std::string const numbers = make_numbers(1000000);
+    bench_numbers("numbers, char", numbers, numbers.size());
+#if defined(__cpp_char8_t)
+    std::u8string const numbers_8(numbers.begin(), numbers.end());
+    bench_numbers("numbers, char8_t", numbers_8, numbers.size());
+#endif
+    std::u32string const numbers_32(numbers.begin(), numbers.end());
+    bench_numbers("numbers, char32_t", numbers_32, numbers.size());
+
+    std::string const coordinates = make_coordinates(1000000);
+    bench_numbers("coordinates, double_", coordinates, coordinates.size());
+    std::u32string const coordinates_32(coordinates.begin(), coordinates.end());
+    bench_numbers(
+        "coordinates, double_, char32_t", coordinates_32, coordinates.size());
+    bench_number_loop(
+        "coordinates, decimal_float",
+        coordinates,
+        [](char const *& first, char const * last, double & x) {
+            using bp::detail::numeric::parse_decimal_float;
+            return parse_decimal_float<bp::float_policies>(first, last, x);
+        });
+#if defined(__cpp_lib_to_chars)
+    bench_number_loop(
+        "coordinates, std::from_chars",
+        coordinates,
+        [](char const *& first, char const * last, double & x) {
+            auto const result = std::from_chars(first, last, x);
+            first = result.ptr;
+            return result.ec == std::errc();
+        });
+#endif
+    bench_number_loop(
+        "coordinates, x3 extract_real",
+        coordinates,
+        [](char const *& first, char const * last, double & x) {
+            using namespace bp::detail_spirit_x3;
+            real_policies<double> policies;
+            return extract_real<double, real_policies<double>>::parse(
+                first, last, x, policies);
+        });
+
+    std::string const matrix = make_matrix(1000000);
+    bench_matrix("matrix, double_ % ',' skipping ws", matrix);
+
+    std::string const integers = make_integers(1000000);
+    bench_integers("integers, int_ % ',' skipping ws", integers);
+}
@@ -0,0 +1,122 @@
+// Copyright (C) 2024 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/parser/parallel_parse.hpp>
+
+#include "perf.hpp"
+
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace bp = boost::parser;
+
+// Newline-terminated records, each a comma-separated list of 1-16 doubles.
+std::string make_input(int records)
+{
+    std::mt19937 g(42);
+    std::string retval;
+    for (int i = 0; i < records; ++i) {
+        int const fields = 1 + g() % 16;
+        for (int j = 0; j < fields; ++j) {
+            if (j)
+                retval += ',';
+            retval += std::to_string(g() % 100000);
+            retval += '.';
+            retval += std::to_string(g() % 1000);
+        }
+        retval += '\n';
+    }
+    return retval;
+}
+
+// A single comma-separated list of about 4 million doubles.
+std::string make_list(int elements)
+{
+    std::mt19937 g(42);
+    std::string retval;
+    for (int i = 0; i < elements; ++i) {
+        if (i)
+            retval += i % 16 ? "," : ",\n";
+        retval += std::to_string(g() % 100000);
+        retval += '.';
+        retval += std::to_string(g() % 1000);
+    }
+    return retval;
+}
+
+int main()
+{
+    std::printf(
+        "parallel_parse (%s, %u hardware threads)\n",
+        perf::simd_config(),
+        std::thread::hardware_concurrency());
+
+    auto const input = make_input(100000);
+    auto const record = bp::double_ % ',';
+
+    perf::run(
+        "split only",
+        input.size(),
+        [&] {
+            std::size_t records = 0;
+            for (auto line : bp::split(input, bp::lit('\n'))) {
+                perf::do_not_optimize(line);
+                ++records;
+            }
+            perf::do_not_optimize(records);
+        },
+        5);
+    perf::run(
+        "split, then parse each record",
+        input.size(),
+        [&] {
+            std::vector<std::optional<std::vector<double>>> results;
+            for (auto line : bp::split(input, bp::lit('\n'))) {
+                results.push_back(bp::parse(line, record));
+            }
+            perf::do_not_optimize(results);
+        },
+        5);
+    for (int n_threads : {1, 2, 4, 8}) {
+        std::string const name =
+            "parallel_parse_records, " + std::to_string(n_threads) +
+            " threads";
+        perf::run(
+            name.c_str(),
+            input.size(),
+            [&] {
+                auto const results = bp::parallel_parse_records(
+                    input, bp::lit('\n'), record, n_threads);
+                perf::do_not_optimize(results);
+            },
+            5);
+    }
+
+    auto const list = make_list(4 * 1024 * 1024);
+    perf::run(
+        "parse one long list",
+        list.size(),
+        [&] {
+            auto const result = bp::parse(list, bp::double_ % ',', bp::ws);
+            perf::do_not_optimize(result);
+        },
+        5);
+    for (int n_threads : {1, 2, 4, 8}) {
+        std::string const name = "parallel_parse_list, " +
+                                 std::to_string(n_threads) + " threads";
+        perf::run(
+            name.c_str(),
+            list.size(),
+            [&] {
+                auto const result = bp::parallel_parse_list(
+                    list, bp::double_, bp::lit(','), bp::ws, n_threads);
+                perf::do_not_optimize(result);
+            },
+            5);
+    }
+}
@@ -0,0 +1,70 @@
+// Copyright (C) 2024 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/parser/parser.hpp>
+
+#include "perf.hpp"
+
+#include <string>
+#include <vector>
+
+
+namespace bp = boost::parser;
+
+// Many short messages, each parsed on its own, as a server might parse
+// requests.
+std::vector<std::string> make_messages(int n)
+{
+    char const * const verbs[] = {"GET", "PUT", "POST", "DELETE"};
+    std::vector<std::string> retval;
+    for (int i = 0; i < n; ++i) {
+        retval.push_back(
+            std::string(verbs[i % 4]) + ' ' + std::to_string(i) + ' ' +
+            std::to_string(i % 100));
+    }
+    return retval;
+}
+
+int main()
+{
+    std::printf("parse_session (%s)\n", perf::simd_config());
+
+    auto const messages = make_messages(10000);
+    std::size_t bytes = 0;
+    for (auto const & message : messages) {
+        bytes += message.size();
+    }
+
+    bp::symbols<int> const verbs = {
+        {"GET", 0}, {"PUT", 1}, {"POST", 2}, {"DELETE", 3}};
+    auto const literal_verbs = bp::lit("GET") | bp::lit("PUT") |
+                               bp::lit("POST") | bp::lit("DELETE");
+    auto const without_symbols = literal_verbs >> bp::int_ >> bp::int_;
+    auto const with_symbols = verbs >> bp::int_ >> bp::int_;
+
+    auto run = [&](char const * name, auto parse_one) {
+        perf::run(name, bytes, [&] {
+            int parsed = 0;
+            for (auto const & message : messages) {
+                parsed += parse_one(message);
+            }
+            perf::do_not_optimize(parsed);
+        });
+    };
+
+    bp::parse_session session;
+    run("no symbols, parse()", [&](std::string const & message) {
+        return bool(bp::parse(message, without_symbols, bp::ws));
+    });
+    run("no symbols, parse_session", [&](std::string const & message) {
+        return bool(session.parse(message, without_symbols, bp::ws));
+    });
+    run("symbols, parse()", [&](std::string const & message) {
+        return bool(bp::parse(message, with_symbols, bp::ws));
+    });
+    run("symbols, parse_session", [&](std::string const & message) {
+        return bool(session.parse(message, with_symbols, bp::ws));
+    });
+}
@@ -0,0 +1,69 @@
+// Copyright (C) 2024 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_PARSER_PERF_PERF_HPP
+#define BOOST_PARSER_PERF_PERF_HPP
+
+#include <boost/parser/config.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+
+namespace perf {
+
+    inline char const * simd_config()
+    {
+#if BOOST_PARSER_USE_AVX2
+        return "AVX2";
+#elif BOOST_PARSER_USE_SSE2
+        return "SSE2";
+#else
+        return "no SIMD";
+#endif
+    }
+
+    template<typename T>
+    void do_not_optimize(T const & x)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "g"(&x) : "memory");
+#else
+        static T const * volatile sink;
+        sink = &x;
+#endif
+    }
+
+    /** Runs `f()` repeatedly, and prints the best time per call.  If `bytes`
+        is nonzero, the throughput for `bytes` bytes per call is printed as
+        well. */
+    template<typename F>
+    void run(char const * name, std::size_t bytes, F f, int reps = 20)
+    {
+        using clock = std::chrono::steady_clock;
+        f(); // warm up
+        double best = 1e300;
+        for (int i = 0; i < reps; ++i) {
+            auto const start = clock::now();
+            f();
+            auto const end = clock::now();
+            best = (std::min)(
+                best, std::chrono::duration<double>(end - start).count());
+        }
+        if (bytes) {
+            std::printf(
+                "%-40s %12.1f us %10.1f MB/s\n",
+                name,
+                best * 1e6,
+                bytes / best / 1e6);
+        } else {
+            std::printf("%-40s %12.1f us\n", name, best * 1e6);
+        }
+    }
+
+}
+
+#endif
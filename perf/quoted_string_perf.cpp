@@ -0,0 +1,80 @@
+// Copyright (C) 2024 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/parser/parser.hpp>
+
+#include "perf.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace bp = boost::parser;
+
+// A JSON-like array of quoted strings of 0-127 chars; every escape_every-th
+// string contains an escaped quote.
+std::string make_input(int strings, int escape_every)
+{
+    std::mt19937 g(42);
+    std::string retval = "[";
+    for (int i = 0; i < strings; ++i) {
+        if (i)
+            retval += ", ";
+        retval += '"';
+        int const len = g() % 128;
+        for (int j = 0; j < len; ++j) {
+            retval += char('a' + g() % 26);
+        }
+        if (escape_every && i % escape_every == 0)
+            retval += "\\\"";
+        retval += '"';
+    }
+    retval += "]";
+    return retval;
+}
+
+int main()
+{
+    std::printf("quoted_string (%s)\n", perf::simd_config());
+
+    bp::symbols<char> const escapes = {
+        {"n", '\n'}, {"t", '\t'}, {"r", '\r'}};
+    auto const no_escapes = make_input(100000, 0);
+    auto const some_escapes = make_input(100000, 4);
+
+    auto const parser = '[' >> bp::quoted_string % ',' >> ']';
+    auto const parser_with_escapes =
+        '[' >> bp::quoted_string('"', escapes) % ',' >> ']';
+
+    auto bench = [](char const * name, std::string const & input, auto p) {
+        perf::run(name, input.size(), [&] {
+            std::vector<std::string> result;
+            bool const success = bp::parse(input, p, bp::ws, result);
+            perf::do_not_optimize(success);
+            perf::do_not_optimize(result);
+        });
+    };
+
+    bench("quoted_string, no escapes", no_escapes, parser);
+    bench("quoted_string, some escapes", some_escapes, parser);
+    bench(
+        "quoted_string(escapes), some escapes",
+        some_escapes,
+        parser_with_escapes);
+
+    auto bench_view = [](char const * name, std::string const & input) {
+        auto const parser = '[' >> bp::quoted_string_view % ',' >> ']';
+        perf::run(name, input.size(), [&] {
+            std::vector<bp::maybe_owned_string> result;
+            bool const success = bp::parse(input, parser, bp::ws, result);
+            perf::do_not_optimize(success);
+            perf::do_not_optimize(result);
+        });
+    };
+
+    bench_view("quoted_string_view, no escapes", no_escapes);
+    bench_view("quoted_string_view, some escapes", some_escapes);
+}
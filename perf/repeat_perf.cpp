@@ -0,0 +1,77 @@
+// Copyright (C) 2024 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/parser/parser.hpp>
+
+#include "perf.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace bp = boost::parser;
+
+// Many short-to-medium runs, as in a tokenizer.
+std::string make_input(std::string_view run_chars, char stop, int runs)
+{
+    std::mt19937 g(42);
+    std::string retval;
+    for (int i = 0; i < runs; ++i) {
+        int const len = g() % 64;
+        for (int j = 0; j < len; ++j) {
+            retval += run_chars[g() % run_chars.size()];
+        }
+        retval += stop;
+    }
+    return retval;
+}
+
+template<typename Parser>
+void bench(char const * name, std::string const & input, Parser parser)
+{
+    perf::run(name, input.size(), [&] {
+        std::vector<std::string> result;
+        bool const success = bp::parse(input, parser, result);
+        perf::do_not_optimize(success);
+        perf::do_not_optimize(result);
+    });
+}
+
+template<typename Parser>
+void bench_no_attr(char const * name, std::string const & input, Parser parser)
+{
+    perf::run(name, input.size(), [&] {
+        bool const success = bp::parse(input, parser);
+        perf::do_not_optimize(success);
+    });
+}
+
+int main()
+{
+    std::printf("repeated char classes (%s)\n", perf::simd_config());
+
+    int const runs = 100000;
+    auto const strings = make_input(
+        "abcdefghijklmnopqrstuvwxyz ABCDEFGHIJKLMNOPQRSTUVWXYZ,.", '"', runs);
+    auto const spaces = make_input(" \t\n", 'x', runs);
+    auto const digits = make_input("0123456789", ',', runs);
+    auto const puncts = make_input("!#%&()*,-./:;?@[]_{}", 'x', runs);
+
+    bench("*(char_ - '\"') >> '\"'", strings, *(*(bp::char_ - '"') >> '"'));
+    bench_no_attr("*ws >> 'x'", spaces, *(*bp::ws >> 'x'));
+    bench("*digit >> ','", digits, *(*bp::digit >> ','));
+    bench("*punct >> 'x'", puncts, *(*bp::punct >> 'x'));
+
+    // Without attributes, the runs are only skipped over.
+    bench_no_attr(
+        "omit[*(char_ - '\"') >> '\"']",
+        strings,
+        bp::omit[*(*(bp::char_ - '"') >> '"')]);
+    bench_no_attr(
+        "omit[*digit >> ',']", digits, bp::omit[*(*bp::digit >> ',')]);
+    bench_no_attr(
+        "omit[*punct >> 'x']", puncts, bp::omit[*(*bp::punct >> 'x')]);
+}
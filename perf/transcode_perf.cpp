@@ -0,0 +1,105 @@
+// Copyright (C) 2024 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/parser/transcode_view.hpp>
+
+#include "perf.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace text = boost::parser::detail::text;
+
+// About a megabyte of words separated by spaces, with letters drawn from
+// letters; each element of letters is a single UTF-8-encoded code point.
+std::string make_text(std::vector<std::string> const & letters)
+{
+    std::mt19937 g(42);
+    std::string retval;
+    while (retval.size() < 1000000) {
+        if (!retval.empty())
+            retval += ' ';
+        int const len = 2 + g() % 10;
+        for (int i = 0; i < len; ++i) {
+            retval += letters[g() % letters.size()];
+        }
+    }
+    return retval;
+}
+
+std::vector<std::string> ascii_letters()
+{
+    std::vector<std::string> retval;
+    for (char c = 'a'; c <= 'z'; ++c) {
+        retval.push_back(std::string(1, c));
+    }
+    return retval;
+}
+
+int main()
+{
+    std::printf("transcode (%s)\n", perf::simd_config());
+
+    auto const ascii = ascii_letters();
+    auto latin = ascii;
+    latin.insert(latin.end(), {"\xc3\xa9", "\xc3\xa8", "\xc3\xa0"});
+    std::vector<std::string> const cjk = {
+        "\xe4\xb8\xad", "\xe6\x96\x87", "\xe5\xad\x97", "\xe7\xac\xa6"};
+    auto emoji = ascii;
+    emoji.insert(
+        emoji.end(),
+        {"\xf0\x9f\x98\x80", "\xf0\x9f\x98\x82", "\xf0\x9f\x91\x8d"});
+
+    auto bench = [](char const * corpus,
+                    std::vector<std::string> const & letters) {
+        std::string const utf8 = make_text(letters);
+        std::u32string utf32;
+        text::transcode_to_utf32(
+            utf8.begin(), utf8.end(), std::back_inserter(utf32));
+        std::vector<char32_t> utf32_buf(utf8.size());
+        std::vector<char> utf8_buf(utf32.size() * 4);
+
+        std::string name;
+        name = std::string(corpus) + ", UTF-8 to UTF-32, per code point";
+        perf::run(name.c_str(), utf8.size(), [&] {
+            auto const r = utf8 | text::as_utf32;
+            auto out = utf32_buf.begin();
+            for (auto it = r.begin(); it != r.end(); ++it, ++out) {
+                *out = *it;
+            }
+            perf::do_not_optimize(utf32_buf);
+        });
+        name = std::string(corpus) + ", UTF-8 to UTF-32, transcode_to_utf32";
+        perf::run(name.c_str(), utf8.size(), [&] {
+            auto const r = text::transcode_to_utf32(
+                utf8.data(), utf8.data() + utf8.size(), utf32_buf.data());
+            perf::do_not_optimize(r.out);
+            perf::do_not_optimize(utf32_buf);
+        });
+        name = std::string(corpus) + ", UTF-32 to UTF-8, per code point";
+        perf::run(name.c_str(), utf8.size(), [&] {
+            auto const r = utf32 | text::as_utf8;
+            auto out = utf8_buf.begin();
+            for (auto it = r.begin(); it != r.end(); ++it, ++out) {
+                *out = *it;
+            }
+            perf::do_not_optimize(utf8_buf);
+        });
+        name = std::string(corpus) + ", UTF-32 to UTF-8, transcode_to_utf8";
+        perf::run(name.c_str(), utf8.size(), [&] {
+            auto const r = text::transcode_to_utf8(
+                utf32.data(), utf32.data() + utf32.size(), utf8_buf.data());
+            perf::do_not_optimize(r.out);
+            perf::do_not_optimize(utf8_buf);
+        });
+    };
+
+    bench("ASCII", ascii);
+    bench("Latin", latin);
+    bench("CJK", cjk);
+    bench("emoji", emoji);
+}
@@ -0,0 +1,157 @@
+// Copyright (C) 2024 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/parser/detail/text/frozen_trie_map.hpp>
+
+#include "perf.hpp"
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace text = boost::parser::detail::text;
+
+// SQL-92 reserved words, plus a few common extensions.
+std::string_view const sql_keywords[] = {
+    "ABSOLUTE",   "ACTION",      "ADD",          "ALL",
+    "ALLOCATE",   "ALTER",       "AND",          "ANY",
+    "ARE",        "AS",          "ASC",          "ASSERTION",
+    "AT",         "AUTHORIZATION", "AVG",        "BEGIN",
+    "BETWEEN",    "BIT",         "BIT_LENGTH",   "BOTH",
+    "BY",         "CASCADE",     "CASCADED",     "CASE",
+    "CAST",       "CATALOG",     "CHAR",         "CHARACTER",
+    "CHAR_LENGTH", "CHARACTER_LENGTH", "CHECK",  "CLOSE",
+    "COALESCE",   "COLLATE",     "COLLATION",    "COLUMN",
+    "COMMIT",     "CONNECT",     "CONNECTION",   "CONSTRAINT",
+    "CONSTRAINTS", "CONTINUE",   "CONVERT",      "CORRESPONDING",
+    "COUNT",      "CREATE",      "CROSS",        "CURRENT",
+    "CURRENT_DATE", "CURRENT_TIME", "CURRENT_TIMESTAMP", "CURRENT_USER",
+    "CURSOR",     "DATE",        "DAY",          "DEALLOCATE",
+    "DEC",        "DECIMAL",     "DECLARE",      "DEFAULT",
+    "DEFERRABLE", "DEFERRED",    "DELETE",       "DESC",
+    "DESCRIBE",   "DESCRIPTOR",  "DIAGNOSTICS",  "DISCONNECT",
+    "DISTINCT",   "DOMAIN",      "DOUBLE",       "DROP",
+    "ELSE",       "END",         "END-EXEC",     "ESCAPE",
+    "EXCEPT",     "EXCEPTION",   "EXEC",         "EXECUTE",
+    "EXISTS",     "EXTERNAL",    "EXTRACT",      "FALSE",
+    "FETCH",      "FIRST",       "FLOAT",        "FOR",
+    "FOREIGN",    "FOUND",       "FROM",         "FULL",
+    "GET",        "GLOBAL",      "GO",           "GOTO",
+    "GRANT",      "GROUP",       "HAVING",       "HOUR",
+    "IDENTITY",   "IMMEDIATE",   "IN",           "INDICATOR",
+    "INITIALLY",  "INNER",       "INPUT",        "INSENSITIVE",
+    "INSERT",     "INT",         "INTEGER",      "INTERSECT",
+    "INTERVAL",   "INTO",        "IS",           "ISOLATION",
+    "JOIN",       "KEY",         "LANGUAGE",     "LAST",
+    "LEADING",    "LEFT",        "LEVEL",        "LIKE",
+    "LIMIT",      "LOCAL",       "LOWER",        "MATCH",
+    "MAX",        "MIN",         "MINUTE",       "MODULE",
+    "MONTH",      "NAMES",       "NATIONAL",     "NATURAL",
+    "NCHAR",      "NEXT",        "NO",           "NOT",
+    "NULL",       "NULLIF",      "NUMERIC",      "OCTET_LENGTH",
+    "OF",         "OFFSET",      "ON",           "ONLY",
+    "OPEN",       "OPTION",      "OR",           "ORDER",
+    "OUTER",      "OUTPUT",      "OVERLAPS",     "PAD",
+    "PARTIAL",    "POSITION",    "PRECISION",    "PREPARE",
+    "PRESERVE",   "PRIMARY",     "PRIOR",        "PRIVILEGES",
+    "PROCEDURE",  "PUBLIC",      "READ",         "REAL",
+    "REFERENCES", "RELATIVE",    "RESTRICT",     "REVOKE",
+    "RIGHT",      "ROLLBACK",    "ROWS",         "SCHEMA",
+    "SCROLL",     "SECOND",      "SECTION",      "SELECT",
+    "SESSION",    "SESSION_USER", "SET",         "SIZE",
+    "SMALLINT",   "SOME",        "SPACE",        "SQL",
+    "SQLCODE",    "SQLERROR",    "SQLSTATE",     "SUBSTRING",
+    "SUM",        "SYSTEM_USER", "TABLE",        "TEMPORARY",
+    "THEN",       "TIME",        "TIMESTAMP",    "TIMEZONE_HOUR",
+    "TIMEZONE_MINUTE", "TO",     "TRAILING",     "TRANSACTION",
+    "TRANSLATE",  "TRANSLATION", "TRIM",         "TRUE",
+    "UNION",      "UNIQUE",      "UNKNOWN",      "UPDATE",
+    "UPPER",      "USAGE",       "USER",         "USING",
+    "VALUE",      "VALUES",      "VARCHAR",      "VARYING",
+    "VIEW",       "WHEN",        "WHENEVER",     "WHERE",
+    "WITH",       "WORK",        "WRITE",        "YEAR",
+    "ZONE"};
+
+// Lowercase and mixed-case copies of the keywords are added as well, so that
+// the nodes near the root have realistic (20-50 child) fan-outs.
+template<typename Key>
+text::trie_map<Key, int> make_trie()
+{
+    text::trie_map<Key, int> retval;
+    int i = 0;
+    for (auto kw : sql_keywords) {
+        std::string s(kw);
+        retval.insert(s, i++);
+        for (auto & c : s) {
+            c = c - 'A' + 'a';
+        }
+        retval.insert(s, i++);
+        s[0] = s[0] - 'a' + 'A';
+        retval.insert(s, i++);
+    }
+    return retval;
+}
+
+std::vector<std::string> make_queries()
+{
+    std::mt19937 g(42);
+    std::vector<std::string> retval;
+    for (int i = 0; i < 100000; ++i) {
+        std::string s(sql_keywords[g() % std::size(sql_keywords)]);
+        switch (g() % 4) {
+        case 0: break;
+        case 1:
+            for (auto & c : s) {
+                c = c - 'A' + 'a';
+            }
+            break;
+        case 2: s.back() = 'Q'; break; // Near-miss.
+        case 3: s = "x_" + s; break;   // Early miss.
+        }
+        retval.push_back(std::move(s));
+    }
+    return retval;
+}
+
+template<typename Trie, typename Queries>
+void bench(char const * name, Trie const & trie, Queries const & queries)
+{
+    std::size_t bytes = 0;
+    for (auto const & q : queries) {
+        bytes += q.size();
+    }
+    perf::run(name, bytes, [&] {
+        int matches = 0;
+        for (auto const & q : queries) {
+            auto const m = trie.longest_match(q.begin(), q.end());
+            matches += m.match;
+        }
+        perf::do_not_optimize(matches);
+    });
+}
+
+int main()
+{
+    std::printf("trie lookups (%s)\n", perf::simd_config());
+
+    auto const queries = make_queries();
+    std::vector<std::u32string> queries_32;
+    for (auto const & q : queries) {
+        queries_32.push_back(std::u32string(q.begin(), q.end()));
+    }
+
+    auto const trie_8 = make_trie<std::vector<char>>();
+    text::frozen_trie_map<std::vector<char>, int> const frozen_8(trie_8);
+    auto const trie_32 = make_trie<std::vector<char32_t>>();
+    text::frozen_trie_map<std::vector<char32_t>, int> const frozen_32(
+        trie_32);
+
+    bench("trie_map<char>", trie_8, queries);
+    bench("frozen_trie_map<char>", frozen_8, queries);
+    bench("trie_map<char32_t>", trie_32, queries_32);
+    bench("frozen_trie_map<char32_t>", frozen_32, queries_32);
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2024 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/parser/parser.hpp>
+#include <boost/parser/transcode_view.hpp>
+
+#include "perf.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace bp = boost::parser;
+
+// Rules are never run on code units, so this parses decoded code points.
+bp::rule<struct decoded_ints_tag, std::vector<int>> const decoded_ints =
+    "decoded_ints";
+auto const decoded_ints_def = bp::int_ % ',';
+BOOST_PARSER_DEFINE_RULES(decoded_ints);
+
+// A comma-separated list of integers.
+std::string make_input(int ints)
+{
+    std::mt19937 g(42);
+    std::string retval;
+    for (int i = 0; i < ints; ++i) {
+        if (i)
+            retval += ',';
+        retval += std::to_string(g() % 1000000);
+    }
+    return retval;
+}
+
+// Space-separated words, mostly ASCII, with an occasional accented letter.
+std::string make_text(int words)
+{
+    std::mt19937 g(42);
+    std::string retval;
+    for (int i = 0; i < words; ++i) {
+        if (i)
+            retval += ' ';
+        int const letters = 2 + g() % 10;
+        for (int j = 0; j < letters; ++j) {
+            if (g() % 32 == 0)
+                retval += "\xc3\xa9";
+            else
+                retval += char('a' + g() % 26);
+        }
+    }
+    return retval;
+}
+
+int main()
+{
+    std::printf("utf8_input (%s)\n", perf::simd_config());
+
+    auto const input = make_input(200000);
+    auto const utf8_input = input | bp::as_utf8;
+
+    auto const ints = bp::int_ % ',';
+
+    auto bench = [&](char const * name, auto const & r, auto p) {
+        perf::run(name, input.size(), [&] {
+            std::vector<int> result;
+            bool const success = bp::parse(r, p, result);
+            perf::do_not_optimize(success);
+            perf::do_not_optimize(result);
+        });
+    };
+
+    bench("char input", input, ints);
+    bench("UTF-8 input, ASCII-only grammar", utf8_input, ints);
+    bench("UTF-8 input, decoded", utf8_input, decoded_ints);
+
+    auto const text = make_text(200000);
+    perf::run("UTF-8 text, decoded", text.size(), [&] {
+        std::vector<std::string> result;
+        bool const success =
+            bp::parse(text | bp::as_utf8, +(bp::cp - ' ') % ' ', result);
+        perf::do_not_optimize(success);
+        perf::do_not_optimize(result);
+    });
+}
@@ -0,0 +1,431 @@
+/**
+ *   Copyright (C) 2024 T. Zachary Laine
+ *
+ *   Distributed under the Boost Software License, Version 1.0. (See
+ *   accompanying file LICENSE_1_0.txt or copy at
+ *   http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/parser/parser.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <list>
+#include <random>
+#include <string>
+
+
+namespace bp = boost::parser;
+
+template<typename T>
+auto bits(T x)
+{
+    std::conditional_t<sizeof(T) == 8, std::uint64_t, std::uint32_t> retval;
+    std::memcpy(&retval, &x, sizeof(T));
+    return retval;
+}
+
+template<typename T>
+auto float_parser()
+{
+    if constexpr (std::is_same_v<T, float>)
+        return bp::float_;
+    else
+        return bp::double_;
+}
+
+// Parses str from char, char32_t and std::list<char> input (which
+// use the underlying chars, the underlying char32_ts, and the list
+// iterators themselves), and checks that the results agree.
+template<typename T>
+std::optional<T> parse_all_ways(std::string const & str)
+{
+    auto const parser = float_parser<T>();
+    auto const result = bp::parse(str, parser);
+
+    std::u32string const u32str(str.begin(), str.end());
+    auto const u32_result = bp::parse(u32str, parser);
+    BOOST_TEST(result.has_value() == u32_result.has_value());
+
+    std::list<char> const list(str.begin(), str.end());
+    auto const list_result = bp::parse(list, parser);
+    BOOST_TEST(result.has_value() == list_result.has_value());
+
+    if (result && u32_result && list_result) {
+        BOOST_TEST(bits(*result) == bits(*u32_result));
+        BOOST_TEST(bits(*result) == bits(*list_result));
+    }
+    return result;
+}
+
+template<typename T>
+void check_value(std::string const & str, T expected)
+{
+    auto const result = parse_all_ways<T>(str);
+    BOOST_TEST(result);
+    if (result) {
+        if (std::isnan(expected))
+            BOOST_TEST(std::isnan(*result));
+        else
+            BOOST_TEST(bits(*result) == bits(expected));
+    }
+}
+
+// Parses str with parser followed by *char_, from char, char32_t and
+// std::list<char> input, and checks the value and the unmatched rest.
+template<typename Parser>
+void check_policy_rest(
+    Parser const & parser,
+    std::string const & str,
+    double expected,
+    std::string const & rest)
+{
+    auto const with_rest = parser >> *bp::char_;
+
+    auto const result = bp::parse(str, with_rest);
+    BOOST_TEST(result);
+    if (result) {
+        BOOST_TEST(bits(std::get<0>(*result)) == bits(expected));
+        BOOST_TEST(std::get<1>(*result) == rest);
+    }
+
+    std::u32string const u32str(str.begin(), str.end());
+    auto const u32_result = bp::parse(u32str, with_rest);
+    BOOST_TEST(u32_result);
+    if (u32_result)
+        BOOST_TEST(bits(std::get<0>(*u32_result)) == bits(expected));
+
+    std::list<char> const list(str.begin(), str.end());
+    auto const list_result = bp::parse(list, with_rest);
+    BOOST_TEST(list_result);
+    if (list_result)
+        BOOST_TEST(bits(std::get<0>(*list_result)) == bits(expected));
+}
+
+template<typename Parser>
+void check_policy_fail(Parser const & parser, std::string const & str)
+{
+    BOOST_TEST(!bp::parse(str, parser));
+    std::u32string const u32str(str.begin(), str.end());
+    BOOST_TEST(!bp::parse(u32str, parser));
+    std::list<char> const list(str.begin(), str.end());
+    BOOST_TEST(!bp::parse(list, parser));
+}
+
+struct underscore_policies : bp::float_policies
+{
+    static constexpr char digit_separator = '_';
+};
+
+struct no_sign_policies : bp::float_policies
+{
+    static constexpr bool allow_plus = false;
+    static constexpr bool allow_minus = false;
+};
+
+#if defined(__cpp_lib_to_chars)
+template<typename T>
+bool check_against_from_chars(std::string const & str)
+{
+    T expected = 0;
+    auto const from_chars_result =
+        std::from_chars(str.data(), str.data() + str.size(), expected);
+    bool const from_chars_ok = from_chars_result.ec == std::errc() &&
+                               from_chars_result.ptr == str.data() + str.size();
+
+    auto const result = parse_all_ways<T>(str);
+    BOOST_TEST(result.has_value() == from_chars_ok);
+    if (!result || !from_chars_ok)
+        return result.has_value() == from_chars_ok;
+    BOOST_TEST(bits(*result) == bits(expected));
+    return bits(*result) == bits(expected);
+}
+#endif
+
+int main()
+{
+
+// exact_and_simple_values
+{
+    check_value<double>("0", 0.0);
+    check_value<double>("-0", -0.0);
+    check_value<double>("+1.5", 1.5);
+    check_value<double>("1e10", 1e10);
+    check_value<double>("1.E2", 100.0);
+    check_value<double>(".25", 0.25);
+    check_value<double>("5.", 5.0);
+    check_value<double>("0.1", 0.1);
+    check_value<double>("123456789e-5", 1234.56789);
+    check_value<double>("9007199254740993", 9007199254740992.0);
+    check_value<double>("1e22", 1e22);
+    check_value<double>("1e23", 1e23);
+    check_value<double>("0.000000000000000000000000000000001", 1e-33);
+    check_value<float>("0.1", 0.1f);
+    check_value<float>("16777217", 16777216.0f);
+    check_value<float>("3.4028235e38", 3.4028235e38f);
+
+    check_value<double>("inf", INFINITY);
+    check_value<double>("-Infinity", -INFINITY);
+    check_value<double>("nan", NAN);
+    check_value<double>("NaN(123)", NAN);
+    check_value<float>("-INF", -INFINITY);
+
+    double const max = std::numeric_limits<double>::max();
+    double const denorm_min = std::numeric_limits<double>::denorm_min();
+    check_value<double>("1.7976931348623157e308", max);
+    check_value<double>("2.2250738585072014e-308", 2.2250738585072014e-308);
+    check_value<double>("2.2250738585072011e-308", 2.2250738585072011e-308);
+    check_value<double>("4.9406564584124654e-324", denorm_min);
+    check_value<double>("3e-324", denorm_min);
+    check_value<float>("1e-45", std::numeric_limits<float>::denorm_min());
+}
+
+// partial_matches
+{
+    auto const parser = bp::double_ >> *bp::char_;
+    auto check_rest = [&](std::string const & str, std::string const & rest) {
+        auto const result = bp::parse(str, parser);
+        BOOST_TEST(result);
+        if (result)
+            BOOST_TEST(std::get<1>(*result) == rest);
+    };
+    check_rest("1e", "e");
+    check_rest("1e+", "e+");
+    check_rest("1.5e-x", "e-x");
+    check_rest("12abc", "abc");
+    check_rest("1.2.3", ".3");
+    check_rest("infinit", "init");
+    check_rest("nan(", "(");
+
+    BOOST_TEST(!bp::parse("", bp::double_));
+    BOOST_TEST(!bp::parse(".", bp::double_));
+    BOOST_TEST(!bp::parse("e5", bp::double_));
+    BOOST_TEST(!bp::parse("+-1", bp::double_));
+    BOOST_TEST(!bp::parse("-", bp::double_));
+}
+
+// out_of_range
+{
+    BOOST_TEST(!parse_all_ways<double>("1e309"));
+    BOOST_TEST(!parse_all_ways<double>("-1.7976931348623159e308"));
+    BOOST_TEST(!parse_all_ways<double>("1e-400"));
+    BOOST_TEST(!parse_all_ways<double>("2.4703282292062327e-324"));
+    BOOST_TEST(!parse_all_ways<float>("3.5e38"));
+    BOOST_TEST(!parse_all_ways<float>("1e-50"));
+    check_value<double>("0e999", 0.0);
+    check_value<double>("2.4703282292062328e-324", 4.9406564584124654e-324);
+}
+
+// halfway_cases
+{
+    // 2^53 + 1 is halfway between 2^53 and 2^53 + 2; ties go to even.
+    check_value<double>("9007199254740993", 9007199254740992.0);
+    check_value<double>("9007199254740995", 9007199254740996.0);
+    check_value<double>(
+        "9007199254740993.00000000000000000000000000000001",
+        9007199254740994.0);
+    check_value<double>(
+        "9007199254740992.99999999999999999999999999999999",
+        9007199254740992.0);
+    // Just above the point halfway between 0 and the smallest subnormal,
+    // but only after the 19th digit.
+    check_value<double>(
+        "2.47032822920623272088284396434110686182529901307162382212792841250"
+        "33776e-324",
+        std::numeric_limits<double>::denorm_min());
+    // 3 * 2^-1075 is exactly halfway between the two smallest subnormals,
+    // and needs all 750-odd digits to tell.
+    check_value<double>(
+        "7.4109846876186981626485318930233205854758970392148714663837852375"
+        "101326090531312779794975454245398856969484704316857659638998506553"
+        "390969459816219401617281718945106978546710679176872575177347315553"
+        "307795408549809608457500958111373034747658096871009590975442271004"
+        "757307809711118935784838675653998783503015228055934046593739791790"
+        "738723868299395818481660169122019456499931289798411362062484498678"
+        "713572180352209017023903285791732520220528974020802906854021606612"
+        "375549983402671300035812486479041385743401875520901590172592547146"
+        "296175134159774938718574737870961645638908718119841271673056017045"
+        "493004705269590165763776884908267986972573366521765567941072508764"
+        "337560846003984904972149117463085539556354188641513168478436313080"
+        "237596295773983001708984375e-324",
+        2 * std::numeric_limits<double>::denorm_min());
+    check_value<double>(
+        "7.4109846876186981626485318930233205854758970392148714663837852375"
+        "101326090531312779794975454245398856969484704316857659638998506553"
+        "390969459816219401617281718945106978546710679176872575177347315553"
+        "307795408549809608457500958111373034747658096871009590975442271004"
+        "757307809711118935784838675653998783503015228055934046593739791790"
+        "738723868299395818481660169122019456499931289798411362062484498678"
+        "713572180352209017023903285791732520220528974020802906854021606612"
+        "375549983402671300035812486479041385743401875520901590172592547146"
+        "296175134159774938718574737870961645638908718119841271673056017045"
+        "493004705269590165763776884908267986972573366521765567941072508764"
+        "337560846003984904972149117463085539556354188641513168478436313080"
+        "237596295773983001708984374999999999999999999999999999999999999999"
+        "9e-324",
+        std::numeric_limits<double>::denorm_min());
+}
+
+// json_number
+{
+    auto const p = bp::json_number;
+    check_policy_rest(p, "0", 0.0, "");
+    check_policy_rest(p, "-0", -0.0, "");
+    check_policy_rest(p, "-12.5e-1", -1.25, "");
+    check_policy_rest(p, "1E+2", 100.0, "");
+    check_policy_rest(p, "0.001", 0.001, "");
+    check_policy_rest(p, "01.5", 0.0, "1.5");
+    check_policy_rest(p, "5.", 5.0, ".");
+    check_policy_rest(p, "5.e3", 5.0, ".e3");
+    check_policy_rest(p, "1e", 1.0, "e");
+    check_policy_rest(p, "1'000", 1.0, "'000");
+    check_policy_rest(
+        p, "1e400", std::numeric_limits<double>::infinity(), "");
+    check_policy_rest(
+        p, "-1e400", -std::numeric_limits<double>::infinity(), "");
+    check_policy_rest(p, "-1e-400", -0.0, "");
+    check_policy_rest(p, "1e-400", 0.0, "");
+    check_policy_rest(p, "0e99999", 0.0, "");
+    check_policy_fail(p, "+1.5");
+    check_policy_fail(p, ".5");
+    check_policy_fail(p, "inf");
+    check_policy_fail(p, "nan");
+    check_policy_fail(p, "-");
+}
+
+// strict_decimal
+{
+    auto const p = bp::strict_decimal;
+    check_policy_rest(p, "+1.5", 1.5, "");
+    check_policy_rest(p, "-007.25", -7.25, "");
+    check_policy_rest(p, "1e10", 1.0, "e10");
+    check_policy_rest(p, "1.", 1.0, ".");
+    check_policy_fail(p, ".5");
+    check_policy_fail(p, "infinity");
+}
+
+// c_literal
+{
+    auto const p = bp::c_literal;
+    check_policy_rest(p, "1'000'000.25", 1000000.25, "");
+    check_policy_rest(p, "1'0.0'5e1'0", 10.05e10, "");
+    check_policy_rest(p, ".5", 0.5, "");
+    check_policy_rest(p, "5.", 5.0, "");
+    check_policy_rest(p, "1e-3f", 1e-3, "f");
+    check_policy_rest(p, "1.5''0", 1.5, "''0");
+    check_policy_rest(p, "1.5'", 1.5, "'");
+    check_policy_rest(p, "1e2'", 100.0, "'");
+    check_policy_rest(p, "1.'5", 1.0, "'5");
+    check_policy_fail(p, "1''0");
+    check_policy_fail(p, "42");
+    check_policy_fail(p, "1'000");
+    check_policy_fail(p, "1e");
+    check_policy_fail(p, "'1");
+    check_policy_fail(p, "-1.5");
+    check_policy_fail(p, "+1.5");
+    check_policy_fail(p, "nan");
+}
+
+// custom_policies
+{
+    bp::parser_interface<bp::float_parser<double, underscore_policies>> const
+        p;
+    check_policy_rest(p, "1_000.000_5", 1000.0005, "");
+    check_policy_rest(p, "-1_0e1_0", -10e10, "");
+    check_policy_rest(p, "inf", INFINITY, "");
+    check_policy_rest(p, "1__0", 1.0, "__0");
+    // A long digit string, with separators in the digits that are dropped
+    // during rounding, still rounds correctly.
+    check_policy_rest(
+        p,
+        "9_007_199_254_740_993.000_000_000_000_000_000_000_000_000_000_01",
+        9007199254740994.0,
+        "");
+
+    bp::parser_interface<bp::float_parser<float, no_sign_policies>> const f;
+    auto const result = bp::parse("2.5", f);
+    BOOST_TEST(result && *result == 2.5f);
+    BOOST_TEST(!bp::parse("-2.5", f));
+    BOOST_TEST(!bp::parse("+2.5", f));
+}
+
+#if defined(__cpp_lib_to_chars)
+// random_values
+{
+    std::mt19937_64 rng(1);
+    char buf[128];
+    int failures = 0;
+    for (int i = 0; i < 20000 && failures < 10; ++i) {
+        std::uint64_t const x = rng();
+        double d;
+        std::memcpy(&d, &x, sizeof(d));
+        if (!std::isfinite(d))
+            continue;
+        int const precision = 1 + int(rng() % 25);
+        std::snprintf(buf, sizeof(buf), "%.*g", precision, d);
+        failures += !check_against_from_chars<double>(buf);
+        failures += !check_against_from_chars<float>(buf);
+
+        float f;
+        std::uint32_t const y = std::uint32_t(x);
+        std::memcpy(&f, &y, sizeof(f));
+        if (!std::isfinite(f))
+            continue;
+        std::snprintf(buf, sizeof(buf), "%.*g", precision, (double)f);
+        failures += !check_against_from_chars<float>(buf);
+    }
+}
+
+// float_halfway_values
+{
+    // Each point halfway between two floats is exactly representable as a
+    // double, and printed exactly with enough digits.
+    std::mt19937 rng(2);
+    char buf[256];
+    int failures = 0;
+    for (int i = 0; i < 20000 && failures < 10; ++i) {
+        std::uint32_t const x = rng() % 0x7f7fffff;
+        float f;
+        std::memcpy(&f, &x, sizeof(f));
+        double const halfway =
+            ((double)f + std::nextafter(f, INFINITY)) / 2;
+        std::snprintf(buf, sizeof(buf), "%.160g", halfway);
+        failures += !check_against_from_chars<float>(buf);
+        std::snprintf(
+            buf, sizeof(buf), "%.160g", std::nextafter(halfway, 0.0));
+        failures += !check_against_from_chars<float>(buf);
+        std::snprintf(
+            buf, sizeof(buf), "%.160g", std::nextafter(halfway, INFINITY));
+        failures += !check_against_from_chars<float>(buf);
+    }
+}
+
+// long_digit_strings
+{
+    std::mt19937 rng(3);
+    int failures = 0;
+    for (int i = 0; i < 2000 && failures < 10; ++i) {
+        std::string str;
+        int const digits = 1 + int(rng() % 900);
+        for (int j = 0; j < digits; ++j) {
+            str += char('0' + rng() % 10);
+        }
+        if (rng() % 2)
+            str.insert(rng() % str.size(), ".");
+        if (rng() % 2)
+            str += "e" + std::to_string(int(rng() % 700) - 350);
+        failures += !check_against_from_chars<double>(str);
+        failures += !check_against_from_chars<float>(str);
+    }
+}
+#endif
+
+return boost::report_errors();
+}
@@ -0,0 +1,203 @@
+/**
+ *   Copyright (C) 2024 T. Zachary Laine
+ *
+ *   Distributed under the Boost Software License, Version 1.0. (See
+ *   accompanying file LICENSE_1_0.txt or copy at
+ *   http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/parser/incremental_parse.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <sstream>
+
+
+namespace bp = boost::parser;
+
+using status = bp::incremental_parse_status;
+
+#if BOOST_PARSER_USE_CONCEPTS
+namespace deduction {
+    auto const parser = bp::int_;
+    auto const skip = bp::ws;
+
+    auto deduced_1 = bp::incremental_parse(parser, skip);
+    auto deduced_2 = bp::incremental_parse(parser);
+}
+#endif
+
+int main()
+{
+
+// whole_message
+{
+    auto const parser = '[' >> bp::int_ % ',' >> ']';
+    bp::incremental_parse session(parser);
+    BOOST_TEST(session.feed("[1,2,3]x") == status::done);
+    BOOST_TEST(session.status() == status::done);
+    BOOST_TEST(*session.result() == std::vector<int>({1, 2, 3}));
+    BOOST_TEST(session.pending() == "x");
+}
+
+// split_message
+{
+    auto const parser = '[' >> bp::int_ % ',' >> ']';
+    bp::incremental_parse session(parser);
+    BOOST_TEST(session.feed("") == status::need_more_input);
+    BOOST_TEST(session.feed("[1") == status::need_more_input);
+    BOOST_TEST(session.feed("2,") == status::need_more_input);
+    BOOST_TEST(session.feed("3") == status::need_more_input);
+    BOOST_TEST(session.feed("]") == status::done);
+    BOOST_TEST(*session.result() == std::vector<int>({12, 3}));
+    BOOST_TEST(session.pending() == "");
+}
+
+// every_split_point
+{
+    std::string const input = "[1,22,333] [4] [55,6]";
+    auto const parser = '[' >> bp::int_ % ',' >> ']';
+    std::vector<std::vector<int>> const expected = {
+        {1, 22, 333}, {4}, {55, 6}};
+    for (std::size_t i = 0; i <= input.size(); ++i) {
+        bp::incremental_parse session(parser, bp::ws);
+        std::vector<std::vector<int>> results;
+        auto drain = [&](status s) {
+            while (s == status::done) {
+                results.push_back(*session.result());
+                s = session.pending().empty() ? status::need_more_input
+                                              : session.feed("");
+            }
+            return s;
+        };
+        BOOST_TEST(
+            drain(session.feed(std::string_view(input).substr(0, i))) !=
+            status::error);
+        BOOST_TEST(
+            drain(session.feed(std::string_view(input).substr(i))) !=
+            status::error);
+        // The skipper looks past the final ']' for more whitespace.
+        BOOST_TEST(results.size() == 2u);
+        BOOST_TEST(drain(session.finish()) == status::need_more_input);
+        BOOST_TEST(results == expected);
+    }
+}
+
+// prefix_of_longer_match
+{
+    // "12" could be the start of "123", and "ab" could be followed by more
+    // "b"s, so neither is done until the parser sees what follows.
+    {
+        bp::incremental_parse session(bp::int_);
+        BOOST_TEST(session.feed("12") == status::need_more_input);
+        BOOST_TEST(session.feed("3") == status::need_more_input);
+        BOOST_TEST(session.feed(" ") == status::done);
+        BOOST_TEST(*session.result() == 123);
+        BOOST_TEST(session.pending() == " ");
+    }
+    {
+        bp::incremental_parse session(bp::int_);
+        BOOST_TEST(session.feed("12") == status::need_more_input);
+        BOOST_TEST(session.finish() == status::done);
+        BOOST_TEST(*session.result() == 12);
+        BOOST_TEST(session.pending() == "");
+    }
+    {
+        bp::incremental_parse session(bp::lit('a') >> *bp::lit('b'));
+        BOOST_TEST(session.feed("ab") == status::need_more_input);
+        BOOST_TEST(session.feed("bc") == status::done);
+        BOOST_TEST(session.result());
+        BOOST_TEST(session.pending() == "c");
+    }
+}
+
+// errors
+{
+    {
+        bp::incremental_parse session(bp::int_);
+        BOOST_TEST(session.feed("x1") == status::error);
+        BOOST_TEST(!session.result());
+        BOOST_TEST(session.feed("2") == status::error);
+        BOOST_TEST(session.pending() == "x12");
+        session.reset();
+        BOOST_TEST(session.feed("12;") == status::done);
+        BOOST_TEST(*session.result() == 12);
+    }
+    {
+        bp::incremental_parse session(bp::int_ >> ';');
+        BOOST_TEST(session.feed("12") == status::need_more_input);
+        BOOST_TEST(session.finish() == status::error);
+    }
+}
+
+// expectation_failures
+{
+    std::ostringstream err;
+    bp::stream_error_handler handler("", err);
+    auto const parser =
+        bp::with_error_handler('{' > bp::int_ > '}', handler);
+    {
+        bp::incremental_parse session(parser);
+        BOOST_TEST(session.feed("{") == status::need_more_input);
+        BOOST_TEST(session.feed("12") == status::need_more_input);
+        BOOST_TEST(err.str() == "");
+        BOOST_TEST(session.feed("}") == status::done);
+        BOOST_TEST(*session.result() == 12);
+        BOOST_TEST(err.str() == "");
+    }
+    {
+        bp::incremental_parse session(parser);
+        BOOST_TEST(session.feed("{12") == status::need_more_input);
+        BOOST_TEST(err.str() == "");
+        BOOST_TEST(session.feed(")") == status::error);
+        BOOST_TEST(err.str() != "");
+    }
+    err.str("");
+    {
+        bp::incremental_parse session(parser);
+        BOOST_TEST(session.feed("{12") == status::need_more_input);
+        BOOST_TEST(err.str() == "");
+        BOOST_TEST(session.finish() == status::error);
+        BOOST_TEST(err.str() != "");
+    }
+}
+
+// long_message
+{
+    // Once a partial match is long, the pending input is only re-parsed
+    // after it has doubled in size, or on finish().
+    std::string input = "[";
+    for (int i = 0; i < 4000; ++i) {
+        input += "1,";
+    }
+    input += "2]";
+    int parses = 0;
+    auto const count = [&](auto &) { ++parses; };
+    auto const parser = bp::lit('[')[count] >> bp::int_ % ',' >> ']';
+    bp::incremental_parse session(parser);
+    int chunks = 0;
+    for (std::size_t i = 0; i < input.size(); i += 100, ++chunks) {
+        BOOST_TEST(
+            session.feed(std::string_view(input).substr(i, 100)) ==
+            status::need_more_input);
+    }
+    BOOST_TEST(parses < chunks / 2 + 10);
+    BOOST_TEST(session.finish() == status::done);
+    BOOST_TEST(session.result()->size() == 4001u);
+    BOOST_TEST(session.result()->back() == 2);
+    BOOST_TEST(session.pending() == "");
+}
+
+// no_attribute
+{
+    bp::incremental_parse session(bp::lit("abc"));
+    BOOST_TEST(session.feed("ab") == status::need_more_input);
+    BOOST_TEST(!session.result());
+    BOOST_TEST(session.feed("cabd") == status::done);
+    BOOST_TEST(session.result());
+    BOOST_TEST(session.pending() == "abd");
+    BOOST_TEST(session.feed("") == status::error);
+}
+
+    return boost::report_errors();
+}
@@ -0,0 +1,128 @@
+/**
+ *   Copyright (C) 2024 T. Zachary Laine
+ *
+ *   Distributed under the Boost Software License, Version 1.0. (See
+ *   accompanying file LICENSE_1_0.txt or copy at
+ *   http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/parser/mapped_file.hpp>
+#include <boost/parser/replace.hpp>
+#include <boost/parser/split.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <cstdio>
+#include <fstream>
+
+
+namespace bp = boost::parser;
+
+#if BOOST_PARSER_USE_CONCEPTS
+static_assert(bp::parsable_range<bp::mapped_file>);
+static_assert(std::ranges::contiguous_range<bp::mapped_file>);
+#endif
+
+void write_file(char const * path, std::string const & contents)
+{
+    std::ofstream ofs(path, std::ios_base::binary);
+    ofs << contents;
+}
+
+int main()
+{
+
+char const * const path = "mapped_file_test.txt";
+
+// parse_mapped_file
+{
+    write_file(path, "1, 2, 3, 42");
+    bp::mapped_file const file(path);
+    BOOST_TEST(file.size() == 11u);
+    BOOST_TEST(std::string(file.begin(), file.end()) == "1, 2, 3, 42");
+
+    auto const result = bp::parse(file, bp::int_ % ',', bp::ws);
+    BOOST_TEST(result);
+    BOOST_TEST(*result == std::vector<int>({1, 2, 3, 42}));
+
+    std::vector<double> doubles;
+    BOOST_TEST(bp::parse(file, bp::double_ % ',', bp::ws, doubles));
+    BOOST_TEST(doubles == std::vector<double>({1.0, 2.0, 3.0, 42.0}));
+
+    auto first = file.begin();
+    auto const prefix = bp::prefix_parse(first, file.end(), bp::int_);
+    BOOST_TEST(prefix);
+    BOOST_TEST(*prefix == 1);
+    BOOST_TEST(first == file.begin() + 1);
+}
+
+// algorithms
+{
+    write_file(path, "aaXYZbaabaXYZ");
+    bp::mapped_file const file(path);
+    {
+        int count = 0;
+        int const offsets[] = {2, 5, 10, 13};
+        for (auto subrange : bp::search_all(file, bp::lit("XYZ"))) {
+            BOOST_TEST(subrange.begin() - file.begin() == offsets[count * 2]);
+            BOOST_TEST(
+                subrange.end() - file.begin() == offsets[count * 2 + 1]);
+            ++count;
+        }
+        BOOST_TEST(count == 2);
+    }
+    {
+        int count = 0;
+        std::string_view const strs[] = {"aa", "baaba", ""};
+        for (auto subrange : file | bp::split(bp::lit("XYZ"))) {
+            BOOST_TEST(
+                std::string_view(
+                    subrange.begin(), subrange.end() - subrange.begin()) ==
+                strs[count]);
+            ++count;
+        }
+        BOOST_TEST(count == 3);
+    }
+    {
+        std::string replaced;
+        for (auto subrange : file | bp::replace(bp::lit("XYZ"), "-")) {
+            replaced.append(subrange.begin(), subrange.end());
+        }
+        BOOST_TEST(replaced == "aa-baaba-");
+    }
+}
+
+// empty_and_moved
+{
+    write_file(path, "");
+    bp::mapped_file file(path);
+    BOOST_TEST(file.empty());
+    BOOST_TEST(file.begin() == file.end());
+    BOOST_TEST(!bp::parse(file, bp::int_));
+    BOOST_TEST(bp::parse(file, *bp::int_));
+
+    write_file(path, "123");
+    bp::mapped_file other(path);
+    file = std::move(other);
+    BOOST_TEST(other.empty());
+    BOOST_TEST(std::string(file.begin(), file.end()) == "123");
+    bp::mapped_file const moved(std::move(file));
+    BOOST_TEST(file.empty());
+    BOOST_TEST(*bp::parse(moved, bp::int_) == 123);
+}
+
+// missing_file
+{
+    std::remove(path);
+    bool threw = false;
+    try {
+        bp::mapped_file file(path);
+    } catch (std::system_error const & e) {
+        threw = true;
+        BOOST_TEST(e.code() == std::errc::no_such_file_or_directory);
+    }
+    BOOST_TEST(threw);
+}
+
+    return boost::report_errors();
+}
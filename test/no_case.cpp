@@ -174,6 +174,28 @@ constexpr auto double_s = u8"sS";       // U+0073 U+0073
     }
 }
 
+// match_any_within_ascii_string
+{
+    constexpr auto abc_p = char_("abc-");
+    BOOST_TEST(parse("b", abc_p));
+    BOOST_TEST(parse(U"-", abc_p));
+    BOOST_TEST(!parse("B", abc_p));
+    BOOST_TEST(!parse(U"B", abc_p));
+    BOOST_TEST(!parse(U"é", abc_p));
+    BOOST_TEST(parse("B", no_case[abc_p]));
+    BOOST_TEST(parse(U"B", no_case[abc_p]));
+    BOOST_TEST(!parse(U"_", no_case[abc_p]));
+
+    // U+212A KELVIN SIGN folds to 'k'.
+    constexpr auto kelvin_p = no_case[char_(U"x\u212a")];
+    BOOST_TEST(parse(U"k", kelvin_p));
+    BOOST_TEST(parse(U"K", kelvin_p));
+    BOOST_TEST(parse(U"X", kelvin_p));
+    BOOST_TEST(!parse(U"j", kelvin_p));
+    constexpr auto k_p = no_case[char_(U"xk")];
+    BOOST_TEST(parse(U"\u212a", k_p));
+}
+
 // symbol_table)
 {
     // without mutation
@@ -0,0 +1,296 @@
+/**
+ *   Copyright (C) 2024 T. Zachary Laine
+ *
+ *   Distributed under the Boost Software License, Version 1.0. (See
+ *   accompanying file LICENSE_1_0.txt or copy at
+ *   http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/parser/parallel_parse.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <sstream>
+#include <stdexcept>
+
+
+namespace bp = boost::parser;
+
+// Enough of JSON to put separators and brackets inside the elements of a
+// list.
+namespace json {
+    bp::rule<struct string_tag> const string = "string";
+    bp::rule<struct value_tag> const value = "value";
+
+    auto const string_def =
+        bp::lexeme['"' >> *((bp::char_ - '"' - '\\') | ('\\' >> bp::char_)) >
+                   '"'];
+    auto const value_def = string | bp::double_ | bp::lit("true") |
+                           bp::lit("false") | bp::lit("null") |
+                           ('[' >> -(value % ',') > ']') |
+                           ('{' >> -((string > ':' > value) % ',') > '}');
+    BOOST_PARSER_DEFINE_RULES(string, value);
+
+    auto const element = bp::raw[value];
+}
+
+std::string make_json_elements(int n)
+{
+    std::string const elements[] = {
+        R"({"a": 1, "b": [2, 3, {"c": "d,e"}]})",
+        R"("x, y")",
+        R"(["[", "]", "{,}"])",
+        R"(42)",
+        R"({"quote \" ,": true, "n": null})",
+        R"([])",
+        R"({ })",
+        R"([[1, 2], [3, [4, 5]], "\\"])"};
+    std::string retval;
+    for (int i = 0; i < n; ++i) {
+        if (i)
+            retval += i % 3 ? ", " : ",\n";
+        retval += elements[i % 8];
+    }
+    return retval;
+}
+
+template<typename Subranges>
+std::vector<std::string> strings(Subranges const & subranges)
+{
+    std::vector<std::string> retval;
+    for (auto subrange : subranges) {
+        retval.push_back(std::string(subrange.begin(), subrange.end()));
+    }
+    return retval;
+}
+
+std::string make_records(int n)
+{
+    std::string retval;
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j <= i % 5; ++j) {
+            if (j)
+                retval += ", ";
+            retval += std::to_string(i * 10 + j);
+        }
+        retval += '\n';
+    }
+    return retval;
+}
+
+int main()
+{
+
+// parallel_parse_records_
+{
+    std::string const input = make_records(1000);
+    auto const record = bp::int_ % ',';
+
+    std::vector<std::optional<std::vector<int>>> expected;
+    for (auto line : bp::split(input, bp::lit('\n'))) {
+        expected.push_back(bp::parse(line, record, bp::ws));
+    }
+    // The trailing newline ends in an empty, unparsable record, as with
+    // split().
+    BOOST_TEST(expected.size() == 1001u);
+    BOOST_TEST(!expected.back());
+
+    for (int n_threads : {0, 1, 2, 3, 8}) {
+        auto const results = bp::parallel_parse_records(
+            input, bp::lit('\n'), record, bp::ws, n_threads);
+        BOOST_TEST(results == expected);
+    }
+    {
+        auto const results =
+            bp::parallel_parse_records(input, bp::lit('\n'), record, 4);
+        BOOST_TEST(results.size() == 1001u);
+        BOOST_TEST(*results[0] == std::vector<int>({0}));
+        BOOST_TEST(!results[1]);
+    }
+}
+
+// records_and_failures
+{
+    char const input[] = "1;2;x;44;;5";
+    auto const results =
+        bp::parallel_parse_records(input, bp::lit(';'), bp::int_, 3);
+    BOOST_TEST(results.size() == 6u);
+    BOOST_TEST(results[0] == 1);
+    BOOST_TEST(results[1] == 2);
+    BOOST_TEST(!results[2]);
+    BOOST_TEST(results[3] == 44);
+    BOOST_TEST(!results[4]);
+    BOOST_TEST(results[5] == 5);
+
+    auto const matched = bp::parallel_parse_records(
+        std::string("ab--abab--ba"), bp::lit("--"), *bp::lit("ab"), 2);
+    BOOST_TEST(matched == std::vector<bool>({true, true, false}));
+
+    BOOST_TEST(
+        bp::parallel_parse_records(std::string(), bp::lit(';'), bp::int_, 2)
+            .empty());
+}
+
+// single_char_delimiters
+{
+    // Single-char delimiters are found without search(); every way of
+    // splitting must match the general path, used for the alternative.
+    auto const record = *bp::char_('a');
+    for (int n = 0; n < 7; ++n) {
+        for (int bits = 0; bits < (1 << n); ++bits) {
+            std::string input;
+            for (int i = 0; i < n; ++i) {
+                input += (bits >> i) & 1 ? ';' : 'a';
+            }
+            auto const fast =
+                bp::parallel_parse_records(input, bp::lit(';'), record, 2);
+            auto const general = bp::parallel_parse_records(
+                input, bp::lit(';') | bp::lit(';'), record, 2);
+            BOOST_TEST(fast == general);
+            std::vector<char> const chars(input.begin(), input.end());
+            BOOST_TEST(
+                bp::parallel_parse_records(chars, bp::char_(';'), record, 2) ==
+                general);
+        }
+    }
+}
+
+// symbol_tables
+{
+    // Each parse compiles or shares the symbol table's tries on first use.
+    bp::symbols<int> const roman = {{"I", 1}, {"V", 5}, {"X", 10}};
+    std::string input;
+    for (int i = 0; i < 300; ++i) {
+        input += "IVX"[i % 3];
+        input += ' ';
+    }
+    auto const results =
+        bp::parallel_parse_records(input, bp::lit(' '), +roman, 4);
+    BOOST_TEST(results.size() == 301u);
+    int const values[] = {1, 5, 10};
+    for (int i = 0; i < 300; ++i) {
+        BOOST_TEST(results[i] == std::vector<int>(1, values[i % 3]));
+    }
+}
+
+// exceptions
+{
+    std::string const input = make_records(100);
+    auto const throw_on_42 = [](auto & ctx) {
+        if (bp::_attr(ctx) == 42)
+            throw std::runtime_error("42");
+    };
+    bool threw = false;
+    try {
+        bp::parallel_parse_records(
+            input, bp::lit('\n'), bp::int_[throw_on_42] % ',', bp::ws, 4);
+    } catch (std::runtime_error const & e) {
+        threw = true;
+        BOOST_TEST(e.what() == std::string("42"));
+    }
+    BOOST_TEST(threw);
+}
+
+// parallel_parse_list_
+{
+    std::string const input = make_json_elements(30000);
+    BOOST_TEST(200000u < input.size());
+    auto const expected = bp::parse(input, json::element % ',', bp::ws);
+    BOOST_TEST(expected);
+    BOOST_TEST(expected->size() == 30000u);
+
+    for (int n_threads : {0, 1, 2, 3, 8}) {
+        auto const result = bp::parallel_parse_list(
+            input, json::element, bp::lit(','), bp::ws, n_threads);
+        BOOST_TEST(result);
+        BOOST_TEST(strings(*result) == strings(*expected));
+    }
+
+    BOOST_TEST(
+        bp::parallel_parse_list(input, json::value, bp::lit(','), bp::ws, 4));
+
+    std::string ints;
+    for (int i = 0; i < 50000; ++i) {
+        ints += std::to_string(i) + (i % 10 ? "," : ",\n");
+    }
+    ints.pop_back();
+    BOOST_TEST(
+        *bp::parallel_parse_list(ints, bp::int_, bp::lit(','), bp::ws, 4) ==
+        *bp::parse(ints, bp::int_ % ',', bp::ws));
+    BOOST_TEST(!bp::parallel_parse_list(ints + ",", bp::int_, bp::lit(','), 4));
+}
+
+// every_chunking
+{
+    // Every guess at every chunk boundary must either be right, or be
+    // caught when the chunks are stitched together.
+    std::string const input = make_json_elements(24);
+    auto const expected = bp::parse(input, json::element % ',', bp::ws);
+    BOOST_TEST(expected);
+    for (std::size_t chunks = 1; chunks < 64; ++chunks) {
+        auto const result = bp::detail::parallel_parse_list_impl(
+            input, json::element, bp::lit(','), bp::ws, 2, chunks);
+        BOOST_TEST(result);
+        BOOST_TEST(strings(*result) == strings(*expected));
+    }
+
+    std::string const ints = "1,22,333,4444,5,66,777,8888,9";
+    for (std::size_t chunks = 1; chunks < ints.size(); ++chunks) {
+        auto const result = bp::detail::parallel_parse_list_impl(
+            ints,
+            bp::int_,
+            bp::lit(','),
+            bp::parser_interface<bp::eps_parser<bp::detail::phony>>{},
+            2,
+            chunks);
+        BOOST_TEST(*result == *bp::parse(ints, bp::int_ % ','));
+    }
+}
+
+// list_failures
+{
+    std::string const input = make_json_elements(24);
+    for (std::size_t i = 0; i < input.size(); i += 7) {
+        // Truncating the input, or putting a stray char in it, makes the
+        // parse fail, or succeed with a different result.
+        for (std::string const & modified :
+             {input.substr(0, i), input.substr(0, i) + "]" + input.substr(i)}) {
+            std::ostringstream err;
+            bp::stream_error_handler handler("", err);
+            auto const element =
+                bp::with_error_handler(json::element, handler);
+            auto const expected = bp::parse(
+                modified,
+                bp::with_error_handler(json::element % ',', handler),
+                bp::ws);
+            std::string const expected_errors = err.str();
+            err.str("");
+            for (std::size_t chunks : {1, 3, 16}) {
+                auto const result = bp::detail::parallel_parse_list_impl(
+                    modified, element, bp::lit(','), bp::ws, 2, chunks);
+                BOOST_TEST(result.has_value() == expected.has_value());
+                if (result && expected)
+                    BOOST_TEST(strings(*result) == strings(*expected));
+                // Only the sequential reparse after a failure reports
+                // errors.
+                BOOST_TEST(err.str() == expected_errors);
+                err.str("");
+            }
+        }
+    }
+
+    BOOST_TEST(
+        !bp::parallel_parse_list(std::string(), bp::int_, bp::lit(',')));
+    BOOST_TEST(
+        !bp::parallel_parse_list(std::string("1,2,"), bp::int_, bp::lit(',')));
+    BOOST_TEST(
+        *bp::parallel_parse_list(std::string("1"), bp::int_, bp::lit(',')) ==
+        std::vector<int>({1}));
+    BOOST_TEST(
+        bp::parallel_parse_list("ab;ab;ab", bp::lit("ab"), bp::lit(';')));
+    BOOST_TEST(
+        !bp::parallel_parse_list("ab;ab;a", bp::lit("ab"), bp::lit(';')));
+}
+
+    return boost::report_errors();
+}
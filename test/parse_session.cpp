@@ -0,0 +1,159 @@
+/**
+ *   Copyright (C) 2024 T. Zachary Laine
+ *
+ *   Distributed under the Boost Software License, Version 1.0. (See
+ *   accompanying file LICENSE_1_0.txt or copy at
+ *   http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/parser/parser.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <optional>
+
+
+namespace bp = boost::parser;
+
+namespace memoized_rules {
+    int term_parses = 0;
+
+    bp::rule<struct term_tag, int> term = "term";
+    bp::rule<struct expr_tag> expr = "expr";
+
+    auto const count_term = [](auto & ctx) {
+        ++term_parses;
+        _val(ctx) = _attr(ctx);
+    };
+    auto const term_def = bp::int_[count_term];
+    auto const expr_def = bp::memoize[term] >> '+' >> expr |
+                          bp::memoize[term] >> '-' >> expr | bp::memoize[term];
+
+    BOOST_PARSER_DEFINE_RULES(term, expr);
+}
+
+namespace callback_rules {
+    struct number_tag
+    {};
+    bp::callback_rule<number_tag, int> const number = "number";
+    auto const number_def = bp::int_;
+    BOOST_PARSER_DEFINE_RULES(number);
+}
+
+int main()
+{
+
+// same_results
+{
+    bp::parse_session session;
+    auto const parser = bp::int_ % ',';
+    for (int i = 0; i < 3; ++i) {
+        BOOST_TEST(
+            *session.parse("1, 2, 3", parser, bp::ws) ==
+            std::vector<int>({1, 2, 3}));
+        BOOST_TEST(!session.parse("1, 2,", parser, bp::ws));
+        BOOST_TEST(*session.parse("4,5", parser) == std::vector<int>({4, 5}));
+
+        std::vector<int> result;
+        BOOST_TEST(session.parse("6,7", parser, result));
+        BOOST_TEST(result == std::vector<int>({6, 7}));
+
+        std::string const str = "8,9x";
+        auto first = str.begin();
+        BOOST_TEST(
+            *session.prefix_parse(first, str.end(), parser) ==
+            std::vector<int>({8, 9}));
+        BOOST_TEST(first == str.end() - 1);
+
+        BOOST_TEST(session.parse(U"10,11", parser));
+    }
+}
+
+// symbol_tables
+{
+    bp::parse_session session;
+    bp::symbols<int> roman_numerals = {{"I", 1}, {"V", 5}, {"X", 10}};
+
+    BOOST_TEST(*session.parse("V", roman_numerals) == 5);
+    BOOST_TEST(!session.parse("L", roman_numerals));
+
+    // Changes made for later parses are seen by the session's next parse.
+    roman_numerals.insert_for_next_parse("L", 50);
+    BOOST_TEST(*session.parse("L", roman_numerals) == 50);
+    roman_numerals.erase_for_next_parse("V");
+    BOOST_TEST(!session.parse("V", roman_numerals));
+
+    auto const add_c = [&](auto & ctx) {
+        roman_numerals.insert_for_next_parse(ctx, "C", 100);
+    };
+    BOOST_TEST(session.parse("X", roman_numerals[add_c]));
+    BOOST_TEST(*session.parse("C", roman_numerals) == 100);
+
+    // Changes made only for the current parse are not.
+    auto const add_m = [&](auto & ctx) {
+        roman_numerals.insert(ctx, "M", 1000);
+    };
+    BOOST_TEST(
+        *session.parse("IM", roman_numerals[add_m] >> roman_numerals) ==
+        1000);
+    BOOST_TEST(!session.parse("M", roman_numerals));
+
+    // Nor is a case-insensitive lookup.
+    BOOST_TEST(*session.parse("x", bp::no_case[roman_numerals]) == 10);
+    BOOST_TEST(!session.parse("x", roman_numerals));
+    BOOST_TEST(*session.parse("X", roman_numerals) == 10);
+
+    // A table destroyed between parses may be replaced by another at the
+    // same address.
+    std::optional<bp::symbols<int>> table;
+    table.emplace(bp::symbols<int>{{"a", 1}});
+    BOOST_TEST(*session.parse("a", *table) == 1);
+    table.reset();
+    table.emplace(bp::symbols<int>{{"b", 2}});
+    BOOST_TEST(!session.parse("a", *table));
+    BOOST_TEST(*session.parse("b", *table) == 2);
+    std::optional<bp::symbols<std::string>> other_table;
+    table.reset();
+    other_table.emplace(bp::symbols<std::string>{{"c", "3"}});
+    BOOST_TEST(*session.parse("c", *other_table) == "3");
+}
+
+// memoization
+{
+    using namespace memoized_rules;
+    bp::parse_session session;
+    for (int i = 0; i < 3; ++i) {
+        term_parses = 0;
+        BOOST_TEST(session.parse("1+2-3", expr));
+        BOOST_TEST(term_parses == 3);
+        BOOST_TEST(session.parse("4+5", expr));
+        BOOST_TEST(term_parses == 5);
+    }
+}
+
+// nested_parses
+{
+    bp::parse_session session;
+    bp::symbols<int> const digits = {{"0", 0}, {"1", 1}};
+    auto const nested = [&](auto & ctx) {
+        // This parse has its own tables, and leaves the session's alone.
+        _pass(ctx) = bool(bp::parse("1", digits));
+    };
+    BOOST_TEST(
+        (*session.parse("01", digits >> bp::eps[nested] >> digits) ==
+         bp::tuple<int, int>(0, 1)));
+    BOOST_TEST(*session.parse("1", digits) == 1);
+}
+
+// callbacks
+{
+    using namespace callback_rules;
+    bp::parse_session session;
+    std::vector<int> numbers;
+    auto const callbacks = [&](number_tag, int x) { numbers.push_back(x); };
+    BOOST_TEST(session.callback_parse("1 2 3", *number, bp::ws, callbacks));
+    BOOST_TEST(numbers == std::vector<int>({1, 2, 3}));
+}
+
+    return boost::report_errors();
+}
@@ -18,6 +18,10 @@
 
 #include <boost/core/lightweight_test.hpp>
 
+#include <cstdio>
+#include <list>
+#include <random>
+
 
 using namespace boost::parser;
 
@@ -458,6 +462,145 @@ int main()
         }
     }
 
+    // fixed_width_uint
+    {
+        // Bounded-width unsigned parsers read char input a word at a time;
+        // their results must match a char-at-a-time parse of UTF-32 input.
+        // Every prefix is tried, so that tails shorter than a word are too.
+        std::vector<std::string> const strs = {
+            "0042",        "1234",        "123456789",    "99999999",
+            "4294967295",  "ffff",        "FfFf",         "00ff",
+            "12g",         "1234abcd",    "ABCDEF12",     "fffffffff",
+            "256",         "65535",       "65536",        "0x1",
+            "12:34:56",    "2024-10-16",  "9\xff",        "/:@G`g"};
+        auto const check = [&](auto parser) {
+            for (auto const & str : strs) {
+                for (std::size_t n = 0; n <= str.size(); ++n) {
+                    std::string const s = str.substr(0, n);
+                    std::u32string const u32(s.begin(), s.end());
+                    char const * first = s.c_str();
+                    auto const result =
+                        prefix_parse(first, s.c_str() + n, parser);
+                    auto first_32 = u32.begin();
+                    auto const expected =
+                        prefix_parse(first_32, u32.end(), parser);
+                    BOOST_TEST(result == expected);
+                    BOOST_TEST(first - s.c_str() == first_32 - u32.begin());
+                }
+            }
+        };
+        check(parser_interface<uint_parser<unsigned int, 10, 2, 2>>{});
+        check(parser_interface<uint_parser<unsigned int, 10, 4, 4>>{});
+        check(parser_interface<uint_parser<unsigned int, 10, 1, 8>>{});
+        check(parser_interface<uint_parser<std::uint8_t, 10, 2, 3>>{});
+        check(parser_interface<uint_parser<std::uint16_t, 10, 0, 5>>{});
+        check(parser_interface<uint_parser<unsigned int, 16, 4, 4>>{});
+        check(parser_interface<uint_parser<unsigned int, 16, 1, 8>>{});
+        check(parser_interface<uint_parser<std::uint8_t, 16, 2, 3>>{});
+        check(parser_interface<uint_parser<int, 16, 2, 8>>{});
+
+        std::string const str = "12:34:56.789";
+        auto const time = parser_interface<uint_parser<int, 10, 2, 2>>{} >>
+                          ':' >>
+                          parser_interface<uint_parser<int, 10, 2, 2>>{} >>
+                          ':' >>
+                          parser_interface<uint_parser<int, 10, 2, 2>>{} >>
+                          '.' >>
+                          parser_interface<uint_parser<int, 10, 3, 3>>{};
+        auto const result = parse(str, time);
+        BOOST_TEST(result);
+        BOOST_TEST((*result == tuple<int, int, int, int>(12, 34, 56, 789)));
+    }
+
+    // numbers_in_any_encoding
+    {
+        // Numbers are parsed from the code units underlying the input,
+        // transcoded or not; the results must match the char-at-a-time
+        // Spirit-derived parsers.
+        std::vector<std::string> const strs = {
+            "42",   "+42",     "-42",  "+-42",   "-",     "+",    "0x1f",
+            "1.5",  "-0.25e2", "+1e3", ".5",     "5.",    "1e",   "12abc",
+            "-inf", "1,2",     "007",  "4294967296", "ffff", "-0"};
+        auto const check = [&](auto parser, auto reference) {
+            for (auto const & str : strs) {
+                auto expected_last = str.begin();
+                auto expected = reference(expected_last, str.end());
+                auto const expected_length = expected_last - str.begin();
+
+                auto const check_one = [&](auto const & r) {
+                    auto const view = r | as_utf32;
+                    auto first = view.begin();
+                    auto const result = prefix_parse(first, view.end(), parser);
+                    BOOST_TEST(result == expected);
+                    if (expected) {
+                        BOOST_TEST(
+                            std::distance(view.begin(), first) ==
+                            expected_length);
+                    }
+                };
+                check_one(str);
+                check_one(std::string_view(str));
+                check_one(std::vector<char>(str.begin(), str.end()));
+                check_one(std::list<char>(str.begin(), str.end()));
+                check_one(std::u16string(str.begin(), str.end()));
+                check_one(std::u32string(str.begin(), str.end()));
+#if defined(__cpp_char8_t)
+                check_one(std::u8string(str.begin(), str.end()));
+#endif
+                char const * first = str.c_str();
+                BOOST_TEST(
+                    prefix_parse(first, null_sentinel_t{}, parser) == expected);
+                if (expected)
+                    BOOST_TEST(first - str.c_str() == expected_length);
+            }
+        };
+        namespace x3 = detail_spirit_x3;
+        check(int_, [](auto & first, auto last) {
+            int x = 0;
+            return x3::extract_int<int, 10, 1, -1>::call(first, last, x)
+                       ? std::optional<int>(x)
+                       : std::nullopt;
+        });
+        check(uint_, [](auto & first, auto last) {
+            unsigned int x = 0;
+            return x3::extract_uint<unsigned int, 10, 1, -1>::call(
+                       first, last, x)
+                       ? std::optional<unsigned int>(x)
+                       : std::nullopt;
+        });
+        check(parser_interface<uint_parser<int>>{}, [](auto & first, auto last) {
+            int x = 0;
+            return x3::extract_uint<int, 10, 1, -1>::call(first, last, x)
+                       ? std::optional<int>(x)
+                       : std::nullopt;
+        });
+        check(
+            parser_interface<int_parser<int, 16>>{},
+            [](auto & first, auto last) {
+                int x = 0;
+                return x3::extract_int<int, 16, 1, -1>::call(first, last, x)
+                           ? std::optional<int>(x)
+                           : std::nullopt;
+            });
+        check(
+            parser_interface<uint_parser<unsigned int, 16, 2, 4>>{},
+            [](auto & first, auto last) {
+                unsigned int x = 0;
+                return x3::extract_uint<unsigned int, 16, 2, 4>::call(
+                           first, last, x)
+                           ? std::optional<unsigned int>(x)
+                           : std::nullopt;
+            });
+        check(double_, [](auto & first, auto last) {
+            double x = 0;
+            x3::real_policies<double> policies;
+            return x3::extract_real<double, x3::real_policies<double>>::parse(
+                       first, last, x, policies)
+                       ? std::optional<double>(x)
+                       : std::nullopt;
+        });
+    }
+
     // bool_
     {
         {
@@ -2383,6 +2526,259 @@ int main()
         }
     }
 
+    // or_dispatch
+    {
+        {
+            constexpr auto parser =
+                string("null") | string("true") | int_ | quoted_string;
+            constexpr auto table = parser.parser_.dispatch_table_;
+            static_assert(table.table_['n'] == 0b0001);
+            static_assert(table.table_['t'] == 0b0010);
+            static_assert(table.table_['7'] == 0b0100);
+            static_assert(table.table_['"'] == 0b1000);
+            static_assert(table.table_['x'] == 0);
+
+            BOOST_TEST(parse("null", parser));
+            BOOST_TEST(parse("true", parser));
+            BOOST_TEST(parse("-42", parser));
+            BOOST_TEST(parse("\"str\"", parser));
+            BOOST_TEST(!parse("x", parser));
+            BOOST_TEST(!parse("", parser));
+            BOOST_TEST(parse(" \"str\" ", parser, ws));
+            BOOST_TEST(!parse("NULL", parser));
+            BOOST_TEST(parse("NULL", no_case[parser]));
+            BOOST_TEST(parse(" True", no_case[parser], ws));
+        }
+
+        {
+            // Overlapping alternatives are still tried in order.
+            constexpr auto parser =
+                string("ab") | string("abc") | char_('a') | char_('x', 'z');
+            std::string str = "abc";
+            auto first = str.begin();
+            BOOST_TEST(prefix_parse(first, str.end(), parser));
+            BOOST_TEST(*first == 'c');
+            BOOST_TEST(parse("y", parser));
+            BOOST_TEST(parse("Y", no_case[parser]));
+            BOOST_TEST(!parse("w", parser));
+        }
+
+        {
+            // Alternatives without a first set are always tried.
+            constexpr auto parser = char_('a') | -char_('b') >> 'c';
+            BOOST_TEST(parse("a", parser));
+            BOOST_TEST(parse("bc", parser));
+            BOOST_TEST(parse("c", parser));
+            BOOST_TEST(!parse("d", parser));
+        }
+
+        {
+            // Non-ASCII input and alternatives.
+            auto const parser = char_('a') | char_(U'é') | upper;
+            BOOST_TEST(parse("a", parser));
+            BOOST_TEST(parse(U"é", parser));
+            BOOST_TEST(parse(U"É", parser));
+            BOOST_TEST(parse(U"É", no_case[parser]));
+            BOOST_TEST(!parse(U"è", parser));
+            // U+212A KELVIN SIGN folds to 'k'.
+            constexpr auto kelvin = char_('a') | char_(U'\u212a');
+            BOOST_TEST(!parse("k", kelvin));
+            BOOST_TEST(parse("k", no_case[kelvin]));
+        }
+    }
+
+    // bulk_repeat
+    {
+        std::string const digits(100, '7');
+        {
+            std::string str = digits + "x";
+            auto first = str.cbegin();
+            std::string result;
+            BOOST_TEST(prefix_parse(first, str.cend(), *digit, result));
+            BOOST_TEST(result == digits);
+            BOOST_TEST(*first == 'x');
+        }
+        {
+            std::string result;
+            BOOST_TEST(parse(digits, +digit, result));
+            BOOST_TEST(result == digits);
+            BOOST_TEST(!parse(digits, repeat(99)[digit]));
+            BOOST_TEST(!parse(digits, repeat(101, Inf)[digit]));
+            BOOST_TEST(parse(digits, repeat(99)[digit] >> digit));
+            BOOST_TEST(parse(digits, repeat(3, 5)[digit] >> *digit));
+
+            std::string str = digits;
+            auto first = str.cbegin();
+            result.clear();
+            BOOST_TEST(prefix_parse(
+                first, str.cend(), repeat(33)[digit], result));
+            BOOST_TEST(result == std::string(33, '7'));
+            BOOST_TEST(first - str.cbegin() == 33);
+        }
+        {
+            constexpr auto parser = '"' >> *(char_ - '"') >> '"';
+            std::string const contents =
+                "a long string, with \xc3\xa9 and several more chars in it";
+            std::string result;
+            BOOST_TEST(parse("\"" + contents + "\"", parser, result));
+            BOOST_TEST(result == contents);
+            result.clear();
+            BOOST_TEST(parse(
+                U"\"" + std::u32string(40, U'é') + U"\"", parser, result));
+            BOOST_TEST(result.size() == 80u);
+            BOOST_TEST(!parse("\"abc", parser));
+        }
+        {
+            constexpr auto parser = *ws >> int_ >> *ws;
+            BOOST_TEST(
+                parse(std::string(40, ' ') + "\t\n42" + "\r\n\r\n", parser));
+            BOOST_TEST(
+                parse(std::string(40, ' ') + "\t\n", repeat(42)[ws] >> eoi));
+            BOOST_TEST(parse("\r\n\r\n", repeat(2)[ws] >> eoi));
+            BOOST_TEST(!parse("\r\n\r\n", repeat(3)[ws] >> eoi));
+        }
+        {
+            std::string const str = "!\"#%&'()*,-./:;?@[\\]_{}";
+            std::string result;
+            BOOST_TEST(parse(str + str, *punct, result));
+            BOOST_TEST(result == str + str);
+            BOOST_TEST(!parse(str + " " + str, *punct));
+        }
+        {
+            // Skipping, no_case[], and attribute-less elements.
+            std::string result;
+            BOOST_TEST(parse(" 1 2 3 ", *digit, ws, result));
+            BOOST_TEST(result == "123");
+            result.clear();
+            std::string const mixed_case = "aAaAaAaAaAaAaAaAaAaAaAaAaAaAaAaAaA";
+            BOOST_TEST(parse(mixed_case, no_case[*char_('a')], result));
+            BOOST_TEST(result == mixed_case);
+            BOOST_TEST(parse(digits, *omit[digit]));
+            BOOST_TEST(parse(digits, *lit('7')));
+        }
+        {
+            // CR begins a match of eol and ws, so it ends a run of char_ -
+            // eol or char_ - ws.
+            std::string str = "abc\r\ndef";
+            auto first = str.cbegin();
+            std::string result;
+            BOOST_TEST(
+                prefix_parse(first, str.cend(), *(char_ - eol), result));
+            BOOST_TEST(result == "abc");
+            BOOST_TEST(first - str.cbegin() == 3);
+
+            std::vector<std::string> lines;
+            BOOST_TEST(parse(str, *(char_ - eol) % eol, lines));
+            BOOST_TEST((lines == std::vector<std::string>{"abc", "def"}));
+
+            BOOST_TEST(!parse("ab\rcd", *(char_ - ws)));
+            first = str.cbegin();
+            result.clear();
+            BOOST_TEST(prefix_parse(first, str.cend(), *(char_ - ws), result));
+            BOOST_TEST(result == "abc");
+            result.clear();
+            BOOST_TEST(parse("ab\rcd", *(char_ - blank), result));
+            BOOST_TEST(result == "ab\rcd");
+
+            // The same holds when ws or eol is inside a nested a - b.
+            std::string const crlf = "ab\r\ncd";
+            auto crlf_first = crlf.cbegin();
+            result.clear();
+            BOOST_TEST(prefix_parse(
+                crlf_first, crlf.cend(), *(char_ - (ws - lit('x'))), result));
+            BOOST_TEST(result == "ab");
+            BOOST_TEST(crlf_first - crlf.cbegin() == 2);
+            crlf_first = crlf.cbegin();
+            result.clear();
+            BOOST_TEST(prefix_parse(
+                crlf_first,
+                crlf.cend(),
+                *(char_ - omit[eol - lit('x')]),
+                result));
+            BOOST_TEST(result == "ab");
+        }
+    }
+
+    // number_lists
+    {
+        {
+            std::vector<double> result;
+            BOOST_TEST(parse("1.5, 2,\t-3e2 ,4", double_ % ',', ws, result));
+            BOOST_TEST((result == std::vector<double>{1.5, 2.0, -300.0, 4.0}));
+            result.clear();
+            BOOST_TEST(parse(U"1.5, 2,\t-3e2 ,4", double_ % ',', ws, result));
+            BOOST_TEST((result == std::vector<double>{1.5, 2.0, -300.0, 4.0}));
+            result.clear();
+            BOOST_TEST(parse("1,\r\n2,\r\n3", double_ % ',', ws, result));
+            BOOST_TEST((result == std::vector<double>{1.0, 2.0, 3.0}));
+        }
+        {
+            std::string const str = "1, 2, 3 ; 4";
+            auto first = str.begin();
+            std::vector<int> result;
+            BOOST_TEST(prefix_parse(first, str.end(), int_ % ',', ws, result));
+            BOOST_TEST((result == std::vector<int>{1, 2, 3}));
+            // Just after the space that follows the 3.
+            BOOST_TEST(first - str.begin() == 8);
+
+            first = str.begin();
+            std::vector<unsigned int> uint_result;
+            BOOST_TEST(prefix_parse(
+                first, str.end(), uint_ % char_(",;"), ws, uint_result));
+            BOOST_TEST((uint_result == std::vector<unsigned int>{1, 2, 3, 4}));
+            BOOST_TEST(first == str.end());
+        }
+        {
+            std::vector<int> result;
+            BOOST_TEST(parse("1, 2, ", int_ % ',' >> -lit(','), ws, result));
+            BOOST_TEST((result == std::vector<int>{1, 2}));
+            result.clear();
+            BOOST_TEST(!parse("1, 2, x", int_ % ',', ws, result));
+
+            std::string const str = "1, -1";
+            auto first = str.begin();
+            std::vector<unsigned int> uint_result;
+            BOOST_TEST(
+                prefix_parse(first, str.end(), uint_ % ',', ws, uint_result));
+            BOOST_TEST((uint_result == std::vector<unsigned int>{1}));
+            BOOST_TEST(first - str.begin() == 1);
+        }
+        {
+            std::vector<long> result;
+            BOOST_TEST(parse(" 1,2", lexeme[long_ % ','], ws, result));
+            BOOST_TEST((result == std::vector<long>{1, 2}));
+            result.clear();
+            BOOST_TEST(!parse("1, 2", lexeme[long_ % ','], ws, result));
+
+            std::vector<float> float_result;
+            BOOST_TEST(parse("0.5, 0.25", double_ % ',', ws, float_result));
+            BOOST_TEST((float_result == std::vector<float>{0.5f, 0.25f}));
+
+            BOOST_TEST(parse("1, 2, 3", omit[int_ % ','], ws));
+            BOOST_TEST(!parse("1, 01", json_number % ',', ws));
+        }
+        {
+            // The same lists, with a delimiter that does not qualify for the
+            // batch loop, parse the same way.
+            std::mt19937 g(42);
+            std::uniform_real_distribution<double> dist(-1e6, 1e6);
+            std::string str;
+            char buf[32];
+            for (int i = 0; i < 1000; ++i) {
+                if (i)
+                    str += i % 8 ? ", " : ",\n";
+                std::snprintf(buf, sizeof(buf), "%.9g", dist(g));
+                str += buf;
+            }
+            std::vector<double> batched;
+            BOOST_TEST(parse(str, double_ % ',', ws, batched));
+            std::vector<double> one_at_a_time;
+            BOOST_TEST(parse(str, double_ % lit(","), ws, one_at_a_time));
+            BOOST_TEST(batched.size() == 1000u);
+            BOOST_TEST(batched == one_at_a_time);
+        }
+    }
+
     // eol_
     {
         {
@@ -2752,6 +3148,15 @@ int main()
         BOOST_TEST(parse(str, parser, char_ - punct, result));
         BOOST_TEST(result == std::vector<uint32_t>({0x21, 0xfda}));
     }
+    {
+        constexpr auto parser = +punct;
+
+        BOOST_TEST(parse(U",-./:;?@", parser));
+        BOOST_TEST(parse(U"\u0f08\u2018\u2045\U0001e95f", parser));
+        BOOST_TEST(!parse(U"\u0f13", parser));
+        BOOST_TEST(!parse(U"\U0010ffff", parser));
+        BOOST_TEST(!parse("a", parser));
+    }
 
     // lower_
     {
@@ -14,6 +14,7 @@
 
 #include <any>
 #include <deque>
+#include <list>
 
 
 using namespace boost::parser;
@@ -2049,6 +2050,199 @@ int main()
 #endif
 }
 
+// ascii_only_utf8
+{
+    // These grammars only match ASCII, so they run on the UTF-8 code units
+    // underlying transcoded input; results must match parsing code points.
+    constexpr auto ints = int_ % ',';
+    {
+        auto const r = "12,34, 56" | as_utf32;
+        auto first = r.begin();
+        std::vector<int> result;
+        BOOST_TEST(prefix_parse(first, r.end(), ints, result));
+        BOOST_TEST(result == std::vector<int>({12, 34}));
+        BOOST_TEST(std::distance(r.begin(), first) == 5);
+    }
+    {
+        auto const result = parse("12, 34 ,56" | as_utf8, ints, lit(' '));
+        BOOST_TEST(result);
+        BOOST_TEST(*result == std::vector<int>({12, 34, 56}));
+    }
+    {
+        auto const r = "1.5 \xc3\xa9" | as_utf32;
+        auto first = r.begin();
+        auto const result =
+            prefix_parse(first, r.end(), double_ >> -(lit(' ') >> 'e'));
+        BOOST_TEST(result);
+        BOOST_TEST(*result == 1.5);
+        BOOST_TEST(*first == U' ');
+        BOOST_TEST(*std::next(first) == U'\xe9');
+    }
+    {
+        // A non-ASCII literal makes the grammar run on code points.
+        auto const result = parse("1\xc3\xa9" "2" | as_utf8, int_ % U'\xe9');
+        BOOST_TEST(result);
+        BOOST_TEST(*result == std::vector<int>({1, 2}));
+    }
+    {
+        std::ostringstream oss;
+        stream_error_handler error_handler("", oss);
+        auto const parser = with_error_handler(int_ > ',' > int_, error_handler);
+        BOOST_TEST(!parse("1;2" | as_utf8, parser));
+        BOOST_TEST(oss.str().find("1:1") != std::string::npos);
+    }
+    {
+        // Errors escape with the caller's iterator type, not the code units'.
+        auto const r = "1;2" | as_utf32;
+        using iter_t = decltype(r.begin());
+        rethrow_error_handler eh;
+        auto const parser = with_error_handler(int_ > ',' > int_, eh);
+        bool caught = false;
+        try {
+            parse(r, parser);
+        } catch (parse_error<iter_t> const & e) {
+            caught = true;
+            BOOST_TEST(std::distance(r.begin(), e.iter) == 1);
+        }
+        BOOST_TEST(caught);
+    }
+#if defined(__cpp_char8_t)
+    {
+        std::u8string const str = u8"ab";
+        auto const r = str | as_utf32;
+        using iter_t = decltype(r.begin());
+        rethrow_error_handler eh;
+        auto const parser = with_error_handler(lit('a') > lit('x'), eh);
+        bool caught = false;
+        try {
+            parse(r, parser);
+        } catch (parse_error<iter_t> const & e) {
+            caught = true;
+            BOOST_TEST(*e.iter == U'b');
+        }
+        BOOST_TEST(caught);
+    }
+    {
+        std::u8string str = u8"true,false";
+        auto first = str.begin();
+        std::vector<bool> result;
+        BOOST_TEST(prefix_parse(first, str.end(), bool_ % ',', result));
+        BOOST_TEST(result == std::vector<bool>({true, false}));
+        BOOST_TEST(first == str.end());
+    }
+#endif
+}
+
+// utf8_ascii_runs
+{
+    // Stepping through runs of ASCII in contiguous UTF-8 skips decoding; the
+    // code points and positions must match those from non-contiguous input.
+    std::string str(100, 'a');
+    str += "\xc3\xa9" + std::string(40, 'b') + "\xff" + std::string(3, 'c') +
+           "\xe2\x82" + std::string(70, 'd') + "\xf0\x9f\x98\x80";
+    std::list<char> const list(str.begin(), str.end());
+    {
+        auto const r = str | as_utf32;
+        auto const list_r = list | as_utf32;
+        BOOST_TEST(std::equal(
+            r.begin(), r.end(), list_r.begin(), list_r.end()));
+        std::vector<char32_t> reversed(
+            std::make_reverse_iterator(r.end()),
+            std::make_reverse_iterator(r.begin()));
+        std::vector<char32_t> list_reversed(
+            std::make_reverse_iterator(list_r.end()),
+            std::make_reverse_iterator(list_r.begin()));
+        BOOST_TEST(reversed == list_reversed);
+    }
+    {
+        auto const r = str | as_utf16;
+        auto const list_r = list | as_utf16;
+        BOOST_TEST(std::equal(
+            r.begin(), r.end(), list_r.begin(), list_r.end()));
+    }
+    {
+        auto const r = str | as_utf32;
+        auto it = r.begin();
+        std::advance(it, 50);
+        BOOST_TEST(it.base() == str.begin() + 50);
+        auto it2 = it;
+        std::advance(it2, 50);
+        BOOST_TEST(*it2 == U'\xe9');
+        BOOST_TEST(it2.base() == str.begin() + 100);
+        --it2;
+        BOOST_TEST(*it2 == U'a');
+        BOOST_TEST(it2.base() == str.begin() + 99);
+        ++it2;
+        ++it2;
+        BOOST_TEST(*it2 == U'b');
+        BOOST_TEST(it2.base() == str.begin() + 102);
+        std::advance(it, 50);
+        BOOST_TEST(it != it2);
+        ++it;
+        BOOST_TEST(it == it2);
+    }
+    {
+        auto const r = str | as_utf32;
+        auto first = r.begin();
+        BOOST_TEST(prefix_parse(
+            first, r.end(), +lit('a') >> lit(U'\xe9') >> +lit('b')));
+        BOOST_TEST(first.base() == str.begin() + 142);
+        BOOST_TEST(*first == U'\xfffd');
+    }
+}
+
+// transcode_ascii_runs
+{
+    // The transcoding algorithms copy long runs of ASCII in contiguous
+    // input at once; the results must match transcoding non-contiguous
+    // input.
+    namespace text = detail::text;
+    std::string str(100, 'a');
+    str += "\xc3\xa9" + std::string(40, 'b') + "\xff" + std::string(3, 'c') +
+           "\xe2\x82" + std::string(70, 'd') + "\xf0\x9f\x98\x80" + "e";
+    std::list<char> const list(str.begin(), str.end());
+
+    std::u32string utf32;
+    text::transcode_to_utf32(
+        list.begin(), list.end(), std::back_inserter(utf32));
+    {
+        std::u32string result;
+        text::transcode_to_utf32(
+            str.begin(), str.end(), std::back_inserter(result));
+        BOOST_TEST(result == utf32);
+    }
+    {
+        std::vector<char32_t> result(str.size());
+        auto const r = text::transcode_to_utf32(
+            str.data(), str.data() + str.size(), result.data());
+        BOOST_TEST(r.in == str.data() + str.size());
+        BOOST_TEST(std::u32string(result.data(), r.out) == utf32);
+    }
+    {
+        std::u16string utf16;
+        text::transcode_to_utf16(
+            list.begin(), list.end(), std::back_inserter(utf16));
+        std::vector<char16_t> result(str.size());
+        auto const r = text::transcode_to_utf16(
+            str.data(), str.data() + str.size(), result.data());
+        BOOST_TEST(std::u16string(result.data(), r.out) == utf16);
+    }
+    {
+        std::list<char32_t> const utf32_list(utf32.begin(), utf32.end());
+        std::string utf8;
+        text::transcode_to_utf8(
+            utf32_list.begin(), utf32_list.end(), std::back_inserter(utf8));
+        std::string result;
+        text::transcode_to_utf8(
+            utf32.begin(), utf32.end(), std::back_inserter(result));
+        BOOST_TEST(result == utf8);
+        std::vector<char> buf(utf8.size());
+        auto const r = text::transcode_to_utf8(
+            utf32.data(), utf32.data() + utf32.size(), buf.data());
+        BOOST_TEST(std::string(buf.data(), r.out) == utf8);
+    }
+}
+
 // attr_out_param_compat
 {
     {
@@ -235,6 +235,118 @@ int main()
     }
 }
 
+// long_strings
+{
+    std::string const text = "a string long enough to span several vector "
+                             "blocks, with \xc3\xa9 and other non-ASCII text";
+
+    {
+        std::string const input = "\"" + text + "\" tail";
+        auto first = input.begin();
+        std::string result;
+        BOOST_TEST(bp::prefix_parse(
+            first, input.end(), bp::quoted_string, result));
+        BOOST_TEST(result == text);
+        BOOST_TEST(std::string(first, input.end()) == " tail");
+    }
+
+    {
+        std::string const input =
+            "\"" + text + "\\\"" + text + "\\\\" + text + "\\\\\"";
+        auto result = bp::parse(input, bp::quoted_string);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == text + "\"" + text + "\\" + text + "\\");
+    }
+
+    {
+        std::string const input = "'" + text + "\\n" + text + "\\t'";
+        auto result = bp::parse(input, bp::quoted_string('\'', cu_escapes));
+        BOOST_TEST(result);
+        BOOST_TEST(*result == text + "\n" + text + "\t");
+    }
+
+    {
+        std::string const input = "'" + text + "\\n" + text + "\\t'";
+        auto result = bp::parse(input, bp::quoted_string("'\"", cp_escapes));
+        BOOST_TEST(result);
+        BOOST_TEST(*result == text + "\n" + text + "\t");
+    }
+
+    {
+        BOOST_TEST(!bp::parse("\"" + text, bp::quoted_string));
+        BOOST_TEST(!bp::parse("\"" + text + "\\", bp::quoted_string));
+        BOOST_TEST(!bp::parse("\"" + text + "\\n\"", bp::quoted_string));
+        BOOST_TEST(!bp::parse(
+            "'" + text + "\\x" + text + "'",
+            bp::quoted_string('\'', cu_escapes)));
+        BOOST_TEST(bp::parse(
+            "\"" + text + "\" \"" + text + "\"",
+            bp::omit[*bp::quoted_string],
+            bp::ws));
+    }
+}
+
+// view
+{
+    static_assert(std::is_same_v<
+                  bp::attribute_t<char const *, decltype(bp::quoted_string_view)>,
+                  bp::maybe_owned_string>);
+
+    {
+        std::string const input = "\"foo\"";
+        auto result = bp::parse(input, bp::quoted_string_view);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == "foo");
+        BOOST_TEST(!result->owned());
+        BOOST_TEST(result->view().data() == input.data() + 1);
+    }
+    {
+        auto result = bp::parse("\"\"", bp::quoted_string_view);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == "");
+        BOOST_TEST(!result->owned());
+    }
+    {
+        auto result = bp::parse("\"f\\\"o\\\\o\"", bp::quoted_string_view);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == "f\"o\\o");
+        BOOST_TEST(result->owned());
+    }
+    {
+        auto result =
+            bp::parse("'foo\\tbar'", bp::quoted_string_view("'\"", cu_escapes));
+        BOOST_TEST(result);
+        BOOST_TEST(*result == "foo\tbar");
+        BOOST_TEST(result->owned());
+    }
+    {
+        auto result = bp::parse("'foo'", bp::quoted_string_view("'\""));
+        BOOST_TEST(result);
+        BOOST_TEST(*result == "foo");
+        BOOST_TEST(!result->owned());
+    }
+    {
+        auto result = bp::parse(
+            "\"foo\" 'bar'", *bp::quoted_string_view("'\""), bp::ws);
+        BOOST_TEST(result);
+        BOOST_TEST(result->size() == 2u);
+        BOOST_TEST((*result)[0] == "foo");
+        BOOST_TEST((*result)[1] == "bar");
+    }
+    {
+        auto result = bp::parse(
+            u8"\"foo\"" | bp::as_utf8, bp::quoted_string_view);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == "foo");
+        BOOST_TEST(result->owned());
+    }
+    {
+        BOOST_TEST(!bp::parse("\"foo", bp::quoted_string_view));
+        BOOST_TEST(!bp::parse("'foo\"", bp::quoted_string_view("'\"")));
+        BOOST_TEST(!bp::parse("\"foo\\x\"", bp::quoted_string_view));
+    }
+}
+
 // doc_examples
 {
     //[ quoted_string_example_1_2
@@ -149,6 +149,25 @@ namespace more_about_rules_4 {
     }
 }
 
+namespace memoized_rules {
+    namespace bp = boost::parser;
+
+    int term_parses = 0;
+
+    bp::rule<struct term_tag, int> term = "term";
+    bp::rule<struct expr_tag> expr = "expr";
+
+    auto const count_term = [](auto & ctx) {
+        ++term_parses;
+        _val(ctx) = _attr(ctx);
+    };
+    auto const term_def = bp::int_[count_term];
+    auto const expr_def = bp::memoize[term] >> '+' >> expr |
+                          bp::memoize[term] >> '-' >> expr | bp::memoize[term];
+
+    BOOST_PARSER_DEFINE_RULES(term, expr);
+}
+
 // clang-format off
 namespace param_example {
     //[ extended_param_yaml_example_rules
@@ -648,5 +667,49 @@ int main()
     (void)result;
 }
 
+// memoize
+{
+    using namespace memoized_rules;
+
+    {
+        term_parses = 0;
+        BOOST_TEST(bp::parse("1+2-3", expr));
+        BOOST_TEST(term_parses == 3);
+    }
+    {
+        term_parses = 0;
+        BOOST_TEST(bp::parse("1 + 2 - 3", expr, bp::ws));
+        BOOST_TEST(term_parses == 3);
+    }
+    {
+        // Transcoded input.
+        term_parses = 0;
+        BOOST_TEST(bp::parse(u"1+2-3", expr));
+        BOOST_TEST(term_parses == 3);
+    }
+    {
+        term_parses = 0;
+        BOOST_TEST(!bp::parse("1+2-", expr));
+        BOOST_TEST(term_parses == 2);
+        BOOST_TEST(bp::parse("1+2", expr));
+        BOOST_TEST(term_parses == 4);
+    }
+    {
+        term_parses = 0;
+        auto const parser = bp::memoize[term] >> 'x' | bp::memoize[term];
+        auto result = bp::parse("12", parser);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == 12);
+        BOOST_TEST(term_parses == 1);
+    }
+    {
+        auto const parser = bp::memoize[bp::string("ab")] >> 'c' |
+                            bp::memoize[bp::string("ab")] >> 'd';
+        BOOST_TEST(bp::parse("abd", parser));
+        BOOST_TEST(!bp::parse("abe", parser));
+        BOOST_TEST(bp::parse(" ab d", parser, bp::ws));
+    }
+}
+
 return boost::report_errors();
 }
@@ -4,6 +4,7 @@
 // accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 #include <boost/parser/parser.hpp>
+#include <boost/parser/transcode_view.hpp>
 
 #include <boost/core/lightweight_test.hpp>
 
@@ -140,6 +141,75 @@ int main()
     }
 }
 
+// symbols_utf8_input
+{
+    symbols<int> const greek = {{"α", 1}, {"αβ", 2}, {"β", 3}, {"γδ", 4}};
+
+    {
+        auto const result = parse("αβγδβ" | as_utf8, +greek);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == std::vector<int>({2, 4, 3}));
+    }
+    {
+        std::string const str = "αγ";
+        auto r = str | as_utf32;
+        auto first = r.begin();
+        auto const result = prefix_parse(first, r.end(), greek);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == 1);
+        BOOST_TEST(first.base() == str.begin() + 2);
+    }
+    BOOST_TEST(!parse("γ" | as_utf8, greek));
+    BOOST_TEST(!parse("ΑΒ" | as_utf8, greek));
+    {
+        auto const result = parse("ΑΒ" | as_utf8, no_case[greek]);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == 2);
+    }
+#if defined(__cpp_char8_t)
+    {
+        auto const result = parse(u8"γδα", greek >> greek);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == (tuple<int, int>(4, 1)));
+    }
+#endif
+}
+
+// symbols_many_entries
+{
+    symbols<int> numbers;
+    for (int i = 0; i < 2000; ++i) {
+        numbers.insert_for_next_parse("n" + std::to_string(i), i);
+    }
+
+    {
+        auto const result = parse("n0", numbers);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == 0);
+    }
+    {
+        auto const result = parse("n1999", numbers);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == 1999);
+    }
+    {
+        auto const result = parse("n19n199n1", +numbers);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == std::vector<int>({19, 199, 1}));
+    }
+    BOOST_TEST(!parse("n2000", numbers));
+    BOOST_TEST(!parse("m1", numbers));
+    {
+        auto const erase_n1 = [&numbers](auto & ctx) {
+            numbers.erase(ctx, "n1");
+        };
+        BOOST_TEST(!parse("n1", eps[erase_n1] >> numbers));
+        auto const result = parse("n1", numbers);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == 1);
+    }
+}
+
 // symbols_mutating
 {
     symbols<int> roman_numerals;
@@ -171,6 +241,76 @@ int main()
     }
 }
 
+// symbols_reused_across_parses
+{
+    symbols<int> roman_numerals = {{"I", 1}, {"V", 5}, {"X", 10}};
+
+    BOOST_TEST(parse("V", roman_numerals));
+    BOOST_TEST(!parse("L", roman_numerals));
+
+    roman_numerals.insert_for_next_parse("L", 50);
+    {
+        auto const result = parse("L", roman_numerals);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == 50);
+    }
+
+    roman_numerals.erase_for_next_parse("V");
+    BOOST_TEST(!parse("V", roman_numerals));
+    BOOST_TEST(parse("X", roman_numerals));
+
+    auto const copy = roman_numerals;
+    {
+        auto const result = parse("L", copy);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == 50);
+    }
+
+    roman_numerals.clear_for_next_parse();
+    BOOST_TEST(!parse("I", roman_numerals));
+    BOOST_TEST(!parse("L", copy));
+}
+
+// symbols_no_case_reused_across_parses
+{
+    symbols<int> keywords = {{"select", 1}, {"from", 2}, {"Straße", 3}};
+
+    for (int i = 0; i < 2; ++i) {
+        auto const result = parse("SELECT", no_case[keywords]);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == 1);
+    }
+    BOOST_TEST(!parse("SELECT", keywords));
+    {
+        auto const result = parse("STRASSE", no_case[keywords]);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == 3);
+    }
+    {
+        auto const result =
+            parse("FROM select", no_case[keywords] >> ' ' >> keywords);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == (tuple<int, int>(2, 1)));
+    }
+
+    keywords.insert_for_next_parse("where", 4);
+    {
+        auto const result = parse("Where", no_case[keywords]);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == 4);
+    }
+    {
+        auto const add_group = [&keywords](auto & ctx) {
+            keywords.insert(ctx, "group", 5);
+        };
+        auto const result =
+            parse("GROUP", eps[add_group] >> no_case[keywords]);
+        BOOST_TEST(result);
+        BOOST_TEST(*result == 5);
+    }
+    BOOST_TEST(!parse("GROUP", no_case[keywords]));
+}
+
 // insert/erase/clear
 {
     symbols<int> roman_numerals;